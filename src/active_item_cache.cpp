@@ -6,50 +6,86 @@
 #include "item.h"
 #include "safe_reference.h"
 
+void active_item_cache::speed_bucket::erase( const cata::slot_map_handle &h )
+{
+    if( !items.contains( h ) ) {
+        return;
+    }
+    const size_t gap = items.index_of( h );
+    if( gap < next ) {
+        // Erasing moves the last item, which is still due, into the gap. Move the gap to the
+        // end of the already returned items first, so that it is filled from the due ones.
+        --next;
+        items.swap_at( gap, next );
+    }
+    items.erase( h );
+    if( next >= items.size() ) {
+        next = 0;
+    }
+}
+
+void active_item_cache::erase( handle_map::iterator it )
+{
+    const item_handles &h = it->second;
+    active_items[h.speed].erase( h.active );
+    if( !h.corpse.is_null() ) {
+        special_items[special_item_type::corpse].erase( h.corpse );
+    }
+    if( !h.explosive.is_null() ) {
+        special_items[special_item_type::explosive].erase( h.explosive );
+    }
+    handles.erase( it );
+}
+
+void active_item_cache::erase_dead( const std::vector<const item *> &dead )
+{
+    for( const item *key : dead ) {
+        // Every entry has exactly one record keyed by its item's address: if a new item
+        // was added at the same address since, the dead entries were replaced then.
+        const auto it = handles.find( key );
+        if( it != handles.end() ) {
+            erase( it );
+        }
+    }
+}
+
 void active_item_cache::remove( const item *it )
 {
-    active_items[it->processing_speed()].remove_if( [it]( const item_reference & active_item ) {
-        item *const target = active_item.item_ref.get();
-        return !target || target == it;
-    } );
-    if( it->can_revive() ) {
-        special_items[ special_item_type::corpse ].remove_if( [it]( const item_reference & active_item ) {
-            item *const target = active_item.item_ref.get();
-            return !target || target == it;
-        } );
-    }
-    if( it->get_use( "explosion" ) ) {
-        special_items[ special_item_type::explosive ].remove_if( [it]( const item_reference &
-        active_item ) {
-            item *const target = active_item.item_ref.get();
-            return !target || target == it;
-        } );
+    const auto found = handles.find( it );
+    if( found != handles.end() ) {
+        erase( found );
     }
 }
 
 void active_item_cache::add( item &it, point location )
 {
-    // If the item is alread in the cache for some reason, don't add a second reference
-    std::list<item_reference> &target_list = active_items[it.processing_speed()];
-    if( std::find_if( target_list.begin(),
-    target_list.end(), [&it]( const item_reference & active_item_ref ) {
-    return &it == active_item_ref.item_ref.get();
-    } ) != target_list.end() ) {
-        return;
+    const auto found = handles.find( &it );
+    if( found != handles.end() ) {
+        const entry *existing = active_items[found->second.speed].items.get( found->second.active );
+        if( existing != nullptr && existing->ref.item_ref.get() == &it ) {
+            // If the item is alread in the cache for some reason, don't add a second reference
+            return;
+        }
+        // Left behind by a destroyed item that used to live at the same address.
+        erase( found );
     }
+    const entry new_entry{ item_reference{ location, it.get_safe_reference() }, &it };
+    item_handles h;
+    h.speed = it.processing_speed();
     if( it.can_revive() ) {
-        special_items[ special_item_type::corpse ].push_back( item_reference{ location, it.get_safe_reference() } );
+        h.corpse = special_items[ special_item_type::corpse ].insert( new_entry );
     }
     if( it.get_use( "explosion" ) ) {
-        special_items[ special_item_type::explosive ].push_back( item_reference{ location, it.get_safe_reference() } );
+        h.explosive = special_items[ special_item_type::explosive ].insert( new_entry );
     }
-    target_list.push_back( item_reference{ location, it.get_safe_reference() } );
+    h.active = active_items[h.speed].items.insert( new_entry );
+    handles.emplace( &it, h );
 }
 
 bool active_item_cache::empty() const
 {
-    for( std::pair<int, std::list<item_reference>> active_queue : active_items ) {
-        if( !active_queue.second.empty() ) {
+    for( const std::pair<const int, speed_bucket> &active_queue : active_items ) {
+        if( !active_queue.second.items.empty() ) {
             return false;
         }
     }
@@ -58,67 +94,93 @@ bool active_item_cache::empty() const
 
 std::vector<item_reference> active_item_cache::get()
 {
+    size_t total = 0;
+    for( const std::pair<const int, speed_bucket> &kv : active_items ) {
+        total += kv.second.items.size();
+    }
     std::vector<item_reference> all_cached_items;
-    for( std::pair<const int, std::list<item_reference>> &kv : active_items ) {
-        for( std::list<item_reference>::iterator it = kv.second.begin(); it != kv.second.end(); ) {
-            if( it->item_ref ) {
-                all_cached_items.emplace_back( *it );
-                ++it;
+    all_cached_items.reserve( total );
+    std::vector<const item *> dead;
+    for( const std::pair<const int, speed_bucket> &kv : active_items ) {
+        for( const entry &e : kv.second.items ) {
+            if( e.ref.item_ref ) {
+                all_cached_items.emplace_back( e.ref );
             } else {
-                it = kv.second.erase( it );
+                dead.push_back( e.key );
             }
         }
     }
+    erase_dead( dead );
     return all_cached_items;
 }
 
 std::vector<item_reference> active_item_cache::get_for_processing()
 {
+    size_t total = 0;
+    for( const std::pair<const int, speed_bucket> &kv : active_items ) {
+        const size_t size = kv.second.items.size();
+        total += std::min( size, size / kv.first + 1 );
+    }
     std::vector<item_reference> items_to_process;
-    for( std::pair<const int, std::list<item_reference>> &kv : active_items ) {
-        // Rely on iteration logic to make sure the number is sane.
-        int num_to_process = kv.second.size() / kv.first;
-        std::list<item_reference>::iterator it = kv.second.begin();
-        for( ; it != kv.second.end() && num_to_process >= 0; ) {
-            if( it->item_ref ) {
-                items_to_process.push_back( *it );
-                --num_to_process;
-                ++it;
+    items_to_process.reserve( total );
+    std::vector<const item *> dead;
+    for( std::pair<const int, speed_bucket> &kv : active_items ) {
+        speed_bucket &bucket = kv.second;
+        const size_t size = bucket.items.size();
+        if( size == 0 ) {
+            continue;
+        }
+        const size_t num_to_process = std::min( size, size / kv.first + 1 );
+        for( size_t i = 0; i < num_to_process; ++i ) {
+            const entry &e = bucket.items[( bucket.next + i ) % size];
+            if( e.ref.item_ref ) {
+                items_to_process.push_back( e.ref );
             } else {
                 // The item has been destroyed, so remove the reference from the cache
-                it = kv.second.erase( it );
+                dead.push_back( e.key );
             }
         }
-        // Rotate the returned items to the end of their list so that the items that weren't
+        // Continue after the returned items next time, so that the items that weren't
         // returned this time will be first in line on the next call
-        kv.second.splice( kv.second.end(), kv.second, kv.second.begin(), it );
+        bucket.next = ( bucket.next + num_to_process ) % size;
     }
+    erase_dead( dead );
     return items_to_process;
 }
 
 std::vector<item_reference> active_item_cache::get_special( special_item_type type )
 {
     std::vector<item_reference> matching_items;
-    for( const item_reference &it : special_items[type] ) {
-        matching_items.push_back( it );
-    }
+    for_each( type, [&matching_items]( const item_reference & ref ) {
+        matching_items.push_back( ref );
+    } );
     return matching_items;
 }
 
 void active_item_cache::subtract_locations( const point &delta )
 {
-    for( std::pair<const int, std::list<item_reference>> &pair : active_items ) {
-        for( item_reference &ir : pair.second ) {
-            ir.location -= delta;
+    for( std::pair<const int, speed_bucket> &pair : active_items ) {
+        for( entry &e : pair.second.items ) {
+            e.ref.location -= delta;
+        }
+    }
+    for( std::pair<const special_item_type, cata::slot_map<entry>> &pair : special_items ) {
+        for( entry &e : pair.second ) {
+            e.ref.location -= delta;
         }
     }
 }
 
 void active_item_cache::rotate_locations( int turns, const point &dim )
 {
-    for( std::pair<const int, std::list<item_reference>> &pair : active_items ) {
-        for( item_reference &ir : pair.second ) {
-            ir.location = ir.location.rotate( turns, dim );
+    for( std::pair<const int, speed_bucket> &pair : active_items ) {
+        for( entry &e : pair.second.items ) {
+            e.ref.location = e.ref.location.rotate( turns, dim );
+        }
+    }
+    for( std::pair<const special_item_type, cata::slot_map<entry>> &pair : special_items ) {
+        for( entry &e : pair.second ) {
+            e.ref.location = e.ref.location.rotate( turns, dim );
         }
     }
 }
@@ -2,13 +2,15 @@
 #ifndef CATA_SRC_ACTIVE_ITEM_CACHE_H
 #define CATA_SRC_ACTIVE_ITEM_CACHE_H
 
+#include <cstddef>
 #include <iosfwd>
-#include <list>
+#include <map>
 #include <unordered_map>
 #include <vector>
 
 #include "point.h"
 #include "safe_reference.h"
+#include "slot_map.h"
 
 class item;
 
@@ -37,14 +39,46 @@ struct hash<special_item_type> {
 class active_item_cache
 {
     private:
-        std::unordered_map<int, std::list<item_reference>> active_items;
-        std::unordered_map<special_item_type, std::list<item_reference>> special_items;
+        /** A cached reference together with the address of the item it was created for. */
+        struct entry {
+            item_reference ref;
+            /** Key into @ref handles. The item may not exist anymore. */
+            const item *key;
+        };
+        /** All cached items sharing one item::processing_speed() */
+        struct speed_bucket {
+            cata::slot_map<entry> items;
+            /**
+             * Dense index at which the next @ref get_for_processing batch starts.
+             * Items before it were already returned in the current round, the rest are still due.
+             */
+            size_t next = 0;
+
+            /** Erases the entry without letting a due item slip before @ref next. */
+            void erase( const cata::slot_map_handle &h );
+        };
+        /** Where the entries of a cached item are stored. */
+        struct item_handles {
+            int speed = 0;
+            cata::slot_map_handle active;
+            cata::slot_map_handle corpse;
+            cata::slot_map_handle explosive;
+        };
+        using handle_map = std::unordered_map<const item *, item_handles>;
+
+        std::map<int, speed_bucket> active_items;
+        std::unordered_map<special_item_type, cata::slot_map<entry>> special_items;
+        /** Lets items be found and removed without searching the buckets. */
+        handle_map handles;
+
+        /** Removes all entries of the item @p it refers to. */
+        void erase( handle_map::iterator it );
+        /** Removes all entries of items that were destroyed without being removed. */
+        void erase_dead( const std::vector<const item *> &dead );
 
     public:
         /**
          * Removes the item if it is in the cache. Does nothing if the item is not in the cache.
-         * Relies on the fact that item::processing_speed() is a constant.
-         * Also removes any items that have been destroyed in the list containing it
          */
         void remove( const item *it );
 
@@ -66,9 +100,9 @@ class active_item_cache
         std::vector<item_reference> get();
 
         /**
-         * Returns the first size() / processing_speed() elements of each list, rounded up.
-         * Items returned are rotated to the back of their respective lists, otherwise only the
-         * first n items will ever be processed.
+         * Returns the next size() / processing_speed() elements of each bucket, rounded up.
+         * Buckets are walked round-robin, so consecutive calls return different items,
+         * otherwise only the first n items would ever be processed.
          * Broken references encountered when collecting the items to be processed are removed from
          * the cache.
          * Relies on the fact that item::processing_speed() is a constant.
@@ -79,6 +113,30 @@ class active_item_cache
          * Returns the currently tracked list of special active items.
          */
         std::vector<item_reference> get_special( special_item_type type );
+
+        /**
+         * Calls @p func with every cached reference of given special type (or every active
+         * item for special_item_type::none) without copying them.
+         * The cache must not be modified from within @p func.
+         */
+        template<typename Func>
+        void for_each( special_item_type type, Func func ) const {
+            if( type == special_item_type::none ) {
+                for( const auto &kv : active_items ) {
+                    for( const entry &e : kv.second.items ) {
+                        func( e.ref );
+                    }
+                }
+                return;
+            }
+            const auto iter = special_items.find( type );
+            if( iter != special_items.end() ) {
+                for( const entry &e : iter->second ) {
+                    func( e.ref );
+                }
+            }
+        }
+
         /** Subtract delta from every item_reference's location */
         void subtract_locations( const point &delta );
         void rotate_locations( int turns, const point &dim );
@@ -104,8 +104,8 @@ void solar_tile::update_internal( time_point to, const tripoint &p, distribution
     time_duration rounded_now = ticks_now * tick_turns;
 
     // TODO: Use something that doesn't calc a ton of worthless crap
-    float sunlight = sum_conditions( zero + rounded_then, zero + rounded_now,
-                                     p ).sunlight / default_daylight_level();
+    float sunlight = sum_hourly_conditions( zero + rounded_then, zero + rounded_now,
+                                            p ).sunlight / default_daylight_level();
     // int64 because we can have years in here
     std::int64_t produced = power * static_cast<std::int64_t>( sunlight ) / 1000;
     grid.mod_resource( static_cast<int>( std::min( static_cast<std::int64_t>( INT_MAX ), produced ) ) );
@@ -163,8 +163,11 @@ void battery_tile::load( JsonObject &jo )
 {
     jo.read( "stored", stored );
     jo.read( "max_stored", max_stored );
+    charge_generation++;
 }
 
+uint64_t battery_tile::charge_generation = 0;
+
 int battery_tile::get_resource() const
 {
     return stored;
@@ -174,6 +177,9 @@ int battery_tile::mod_resource( int amt )
 {
     // TODO: Avoid int64 math if possible
     std::int64_t sum = static_cast<std::int64_t>( stored ) + amt;
+    if( amt != 0 ) {
+        charge_generation++;
+    }
     if( sum >= max_stored ) {
         stored = max_stored;
         return sum - max_stored;
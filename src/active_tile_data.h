@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_ACTIVE_TILE_DATA_H
 #define CATA_SRC_ACTIVE_TILE_DATA_H
 
+#include <cstdint>
 #include <string>
 #include "calendar.h"
 #include "point.h"
@@ -80,6 +81,9 @@ class battery_tile : public active_tile_data
 
         int get_resource() const;
         int mod_resource( int amt );
+
+        /** Incremented whenever the charge of any battery tile changes. */
+        static uint64_t charge_generation;
 };
 
 class charger_tile : public active_tile_data
@@ -1616,6 +1616,7 @@ void activity_handlers::fill_liquid_do_turn( player_activity *act, player *p )
                 break;
             case LST_MAP_ITEM:
                 on_ground->charges -= removed_charges;
+                g->m.mark_changed( source_pos );
                 if( on_ground->charges <= 0 ) {
                     source_stack.erase( on_ground );
                     if( g->m.ter( source_pos ).obj().examine == &iexamine::gaspump ) {
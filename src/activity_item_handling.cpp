@@ -6,6 +6,7 @@
 #include <cstdlib>
 #include <iterator>
 #include <list>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
@@ -102,6 +103,7 @@ static const zone_type_id zone_type_CONSTRUCTION_BLUEPRINT( "CONSTRUCTION_BLUEPR
 static const zone_type_id zone_type_FARM_PLOT( "FARM_PLOT" );
 static const zone_type_id zone_type_FISHING_SPOT( "FISHING_SPOT" );
 static const zone_type_id zone_type_LOOT_CORPSE( "LOOT_CORPSE" );
+static const zone_type_id zone_type_LOOT_CUSTOM( "LOOT_CUSTOM" );
 static const zone_type_id zone_type_LOOT_IGNORE( "LOOT_IGNORE" );
 static const zone_type_id zone_type_MINING( "MINING" );
 static const zone_type_id zone_type_LOOT_UNSORTED( "LOOT_UNSORTED" );
@@ -2046,6 +2048,59 @@ static bool chop_plank_activity( player &p, const tripoint &src_loc )
     return false;
 }
 
+namespace
+{
+/** A tile near the sorting character that items of some loot zone type can be put on. */
+struct loot_destination {
+    tripoint abs_pos;
+    tripoint local_pos;
+    // Items have to pass the filter of a custom loot zone here
+    bool custom;
+    bool in_vehicle;
+    units::volume free_space;
+    int item_count;
+};
+} // namespace
+
+/**
+ * Destinations of the given zone type, nearest to @p src_loc first because moving items there
+ * costs the least. Gathered once per source tile and then kept up to date while items are moved,
+ * instead of recomputing the zone points and the free volume of every tile for every item.
+ */
+static std::vector<loot_destination> sort_loot_destinations( const zone_manager &mgr,
+        const zone_type_id &id, const tripoint &abspos, const tripoint &src_loc )
+{
+    std::vector<loot_destination> destinations;
+    for( const tripoint &dest : mgr.get_near( id, abspos, ACTIVITY_SEARCH_DISTANCE ) ) {
+        const tripoint dest_loc = g->m.getlocal( dest );
+        // skip tiles with inaccessible furniture, like filled charcoal kiln
+        if( !g->m.can_put_items_ter_furn( dest_loc ) ) {
+            continue;
+        }
+        loot_destination destination;
+        destination.abs_pos = dest;
+        destination.local_pos = dest_loc;
+        destination.custom = mgr.has( zone_type_LOOT_CUSTOM, dest );
+        destination.item_count = static_cast<int>( g->m.i_at( dest_loc ).size() );
+        // if there's a vehicle with space do not check the tile beneath
+        if( const cata::optional<vpart_reference> vp = g->m.veh_at( dest_loc ).part_with_feature( "CARGO",
+                false ) ) {
+            destination.in_vehicle = true;
+            destination.free_space = vp->vehicle().free_volume( vp->part_index() );
+        } else {
+            destination.in_vehicle = false;
+            destination.free_space = g->m.free_volume( dest_loc );
+        }
+        destinations.push_back( destination );
+    }
+    std::sort( destinations.begin(), destinations.end(),
+    [&src_loc]( const loot_destination & a, const loot_destination & b ) {
+        return std::make_tuple( rl_dist( src_loc, a.local_pos ), a.abs_pos ) <
+               std::make_tuple( rl_dist( src_loc, b.local_pos ), b.abs_pos );
+    } );
+    return destinations;
+}
+
 void activity_on_turn_move_loot( player_activity &act, player &p )
 {
     enum activity_stage : int {
@@ -2187,8 +2242,8 @@ void activity_on_turn_move_loot( player_activity &act, player &p )
 
         // the boolean in this pair being true indicates the item is from a vehicle storage space
         auto items = std::vector<std::pair<item *, bool>>();
-        vehicle *src_veh, *dest_veh;
-        int src_part, dest_part;
+        vehicle *src_veh;
+        int src_part;
 
         //Check source for cargo part
         //map_stack and vehicle_stack are different types but inherit from item_stack
@@ -2208,6 +2263,9 @@ void activity_on_turn_move_loot( player_activity &act, player &p )
             items.push_back( std::make_pair( &it, false ) );
         }
 
+        // Destinations of each zone type the items here belong to
+        std::map<zone_type_id, std::vector<loot_destination>> destinations;
+
         //Skip items that have already been processed
         for( auto it = items.begin() + num_processed; it < items.end(); ++it ) {
             ++num_processed;
@@ -2232,44 +2290,28 @@ void activity_on_turn_move_loot( player_activity &act, player &p )
                 continue;
             }
 
-            const std::unordered_set<tripoint> &dest_set = mgr.get_near( id, abspos, ACTIVITY_SEARCH_DISTANCE,
-                    &thisitem );
-            for( const tripoint &dest : dest_set ) {
-                const tripoint &dest_loc = g->m.getlocal( dest );
-
-                //Check destination for cargo part
-                if( const cata::optional<vpart_reference> vp = g->m.veh_at( dest_loc ).part_with_feature( "CARGO",
-                        false ) ) {
-                    dest_veh = &vp->vehicle();
-                    dest_part = vp->part_index();
-                } else {
-                    dest_veh = nullptr;
-                    dest_part = -1;
-                }
-
-                // skip tiles with inaccessible furniture, like filled charcoal kiln
-                if( !g->m.can_put_items_ter_furn( dest_loc ) ||
-                    static_cast<int>( g->m.i_at( dest_loc ).size() ) >= MAX_ITEM_IN_SQUARE ) {
+            auto dest_iter = destinations.find( id );
+            if( dest_iter == destinations.end() ) {
+                dest_iter = destinations.emplace( id, sort_loot_destinations( mgr, id, abspos,
+                                                  src_loc ) ).first;
+            }
+            const units::volume volume = thisitem.volume();
+            for( loot_destination &dest : dest_iter->second ) {
+                if( dest.item_count >= MAX_ITEM_IN_SQUARE || dest.free_space < volume ||
+                    ( dest.custom && !mgr.custom_loot_has( dest.abs_pos, &thisitem ) ) ) {
                     continue;
                 }
-
-                units::volume free_space;
-                // if there's a vehicle with space do not check the tile beneath
-                if( dest_veh ) {
-                    free_space = dest_veh->free_volume( dest_part );
-                } else {
-                    free_space = g->m.free_volume( dest_loc );
+                move_item( p, thisitem, thisitem.count(), src_loc, dest.local_pos, this_veh, this_part );
+                dest.free_space -= volume;
+                if( !dest.in_vehicle ) {
+                    dest.item_count++;
                 }
-                // check free space at destination
-                if( free_space >= thisitem.volume() ) {
-                    move_item( p, thisitem, thisitem.count(), src_loc, dest_loc, this_veh, this_part );
 
-                    // moved item away from source so decrement
-                    if( num_processed > 0 ) {
-                        --num_processed;
-                    }
-                    break;
+                // moved item away from source so decrement
+                if( num_processed > 0 ) {
+                    --num_processed;
                 }
+                break;
             }
             if( p.moves <= 0 ) {
                 return;
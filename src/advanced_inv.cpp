@@ -8,6 +8,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -411,10 +412,45 @@ void advanced_inventory::print_items( const advanced_inventory_pane &pane, bool
     }
 }
 
+/**
+ * Sort keys that are costly to compute (they walk contents or build strings),
+ * memoized per item for the duration of sorting one pane.
+ */
+struct advanced_inv_sort_keys {
+    std::unordered_map<const item *, int> prices;
+    std::unordered_map<const item *, int> spoilage;
+    std::unordered_map<const item *, std::string> ammo_names;
+
+    template<typename T, typename F>
+    static const T &memoized( std::unordered_map<const item *, T> &memo, item *it, F compute ) {
+        auto found = memo.find( it );
+        if( found == memo.end() ) {
+            found = memo.emplace( it, compute( *it ) ).first;
+        }
+        return found->second;
+    }
+    int price( item *it ) {
+        return memoized( prices, it, []( item & i ) {
+            return i.price( true );
+        } );
+    }
+    int spoilage_sort_order( item *it ) {
+        return memoized( spoilage, it, []( item & i ) {
+            return i.spoilage_sort_order();
+        } );
+    }
+    const std::string &ammo_sort_name( item *it ) {
+        return memoized( ammo_names, it, []( item & i ) {
+            return i.ammo_sort_name();
+        } );
+    }
+};
+
 struct advanced_inv_sorter {
     advanced_inv_sortby sortby;
-    advanced_inv_sorter( advanced_inv_sortby sort ) {
-        sortby = sort;
+    advanced_inv_sort_keys *keys;
+    advanced_inv_sorter( advanced_inv_sortby sort, advanced_inv_sort_keys &keys ) : sortby( sort ),
+        keys( &keys ) {
     }
     bool operator()( const advanced_inv_listitem &d1, const advanced_inv_listitem &d2 ) {
         // Note: the item pointer can only be null on sort by category, otherwise it is always valid.
@@ -459,8 +495,8 @@ struct advanced_inv_sorter {
                 }
                 break;
             case SORTBY_AMMO: {
-                const std::string a1 = d1.items.front()->ammo_sort_name();
-                const std::string a2 = d2.items.front()->ammo_sort_name();
+                const std::string &a1 = keys->ammo_sort_name( d1.items.front() );
+                const std::string &a2 = keys->ammo_sort_name( d2.items.front() );
                 // There are many items with "false" ammo types (e.g.
                 // scrap metal has "components") that actually is not
                 // used as ammo, so we consider them as non-ammo.
@@ -495,16 +531,22 @@ struct advanced_inv_sorter {
                 }
             }
             break;
-            case SORTBY_SPOILAGE:
-                if( d1.items.front()->spoilage_sort_order() != d2.items.front()->spoilage_sort_order() ) {
-                    return d1.items.front()->spoilage_sort_order() < d2.items.front()->spoilage_sort_order();
+            case SORTBY_SPOILAGE: {
+                const int s1 = keys->spoilage_sort_order( d1.items.front() );
+                const int s2 = keys->spoilage_sort_order( d2.items.front() );
+                if( s1 != s2 ) {
+                    return s1 < s2;
                 }
-                break;
-            case SORTBY_PRICE:
-                if( d1.items.front()->price( true ) != d2.items.front()->price( true ) ) {
-                    return d1.items.front()->price( true ) > d2.items.front()->price( true );
+            }
+            break;
+            case SORTBY_PRICE: {
+                const int p1 = keys->price( d1.items.front() );
+                const int p2 = keys->price( d2.items.front() );
+                if( p1 != p2 ) {
+                    return p1 > p2;
                 }
-                break;
+            }
+            break;
         }
         // secondary sort by name
         const std::string *n1;
@@ -613,7 +655,9 @@ void advanced_inventory::recalc_pane( side p )
         }
     }
     // Finally sort all items (category headers will now be moved to their proper position)
-    std::stable_sort( pane.items.begin(), pane.items.end(), advanced_inv_sorter( pane.sortby ) );
+    advanced_inv_sort_keys sort_keys;
+    std::stable_sort( pane.items.begin(), pane.items.end(), advanced_inv_sorter( pane.sortby,
+                      sort_keys ) );
     // itemsPerPage is 0 during processing
     if( itemsPerPage > 0 ) {
         pane.paginate( itemsPerPage );
@@ -628,6 +672,8 @@ void advanced_inventory::redraw_pane( side p )
     if( is_processing() ) {
         return;
     }
+    // Building, filtering, sorting and printing the list asks for the same names repeatedly
+    scoped_tname_cache name_cache;
     auto &pane = panes[p];
     if( recalc || pane.recalc ) {
         recalc_pane( p );
@@ -69,15 +69,36 @@ bool advanced_inventory_pane::is_filtered( const item &it ) const
         return false;
     }
 
-    const std::string str = it.tname();
-    if( filtercache.find( str ) == filtercache.end() ) {
-        const auto filter_fn = item_filter_from_string( filter );
-        filtercache[str] = filter_fn;
-
+    update_filter_cache();
+    if( !is_name_only_filter( filter ) ) {
         return !filter_fn( it );
     }
+    const std::string str = it.tname();
+    auto found = name_matches.find( str );
+    if( found == name_matches.end() ) {
+        found = name_matches.emplace( str, filter_fn( it ) ).first;
+    }
+    return !found->second;
+}
 
-    return !filtercache[str]( it );
+void advanced_inventory_pane::update_filter_cache() const
+{
+    if( filter_fn && cached_filter == filter ) {
+        return;
+    }
+    if( filter_fn && filter_narrows( cached_filter, filter ) ) {
+        for( auto iter = name_matches.begin(); iter != name_matches.end(); ) {
+            if( iter->second ) {
+                iter = name_matches.erase( iter );
+            } else {
+                ++iter;
+            }
+        }
+    } else {
+        name_matches.clear();
+    }
+    cached_filter = filter;
+    filter_fn = item_filter_from_string( filter );
 }
 
 void advanced_inventory_pane::add_items_from_area( advanced_inv_area &square,
@@ -276,6 +297,5 @@ void advanced_inventory_pane::set_filter( const std::string &new_filter )
         return;
     }
     filter = new_filter;
-    filtercache.clear();
     recalc = true;
 }
@@ -5,7 +5,7 @@
 #include <array>
 #include <cstddef>
 #include <functional>
-#include <map>
+#include <unordered_map>
 #include <string>
 #include <vector>
 
@@ -126,6 +126,16 @@ class advanced_inventory_pane
         /** Only add offset to index, but wrap around! */
         void mod_index( int offset );
 
-        mutable std::map<std::string, std::function<bool( const item & )>> filtercache;
+        /** Brings @ref filter_fn and @ref name_matches up to date with @ref filter */
+        void update_filter_cache() const;
+        /** The filter @ref filter_fn and @ref name_matches were built for */
+        mutable std::string cached_filter;
+        mutable std::function<bool( const item & )> filter_fn;
+        /**
+         * Whether item names match @ref filter, remembered as long as the filter only looks
+         * at names. When the query is refined ("ri" -> "rif"), names that did not match
+         * before are kept, they cannot match the narrower query either.
+         */
+        mutable std::unordered_map<std::string, bool> name_matches;
 };
 #endif // CATA_SRC_ADVANCED_INV_PANE_H
@@ -2255,8 +2255,19 @@ class Character : public Creature, public visitable<Character>
         struct weighted_int_list<std::string> melee_miss_reasons;
 
         int cached_moves = 0;
-        tripoint cached_position;
         inventory cached_crafting_inventory;
+        /**
+         * Map part of @ref cached_crafting_inventory. Unlike the rest it's kept across
+         * moves and turns, until the map around @ref cached_nearby_position changes.
+         */
+        inventory cached_nearby_inventory;
+        tripoint cached_nearby_position;
+        int cached_nearby_radius = -1;
+        bool cached_nearby_clear_path = false;
+        uint64_t cached_nearby_change = 0;
+        time_point cached_nearby_time = calendar::before_time_starts;
+        /** Rebuilds @ref cached_nearby_inventory if needed, returns whether it did. */
+        bool update_nearby_inventory( const tripoint &inv_pos, int radius, bool clear_path );
 
     protected:
         // a cache of all active enchantment values.
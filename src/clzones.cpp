@@ -31,6 +31,7 @@
 #include "player.h"
 #include "string_formatter.h"
 #include "string_input_popup.h"
+#include "string_utils.h"
 #include "translations.h"
 #include "ui.h"
 #include "value_ptr.h"
@@ -600,13 +601,7 @@ void zone_manager::cache_data()
             continue;
         }
 
-        const std::string &type_hash = elem.get_type_hash();
-        auto &cache = area_cache[type_hash];
-
-        // Draw marked area
-        for( const tripoint &p : tripoint_range( elem.get_start_point(), elem.get_end_point() ) ) {
-            cache.insert( p );
-        }
+        area_cache[elem.get_type_hash()].emplace_back( elem.get_start_point(), elem.get_end_point() );
     }
 }
 
@@ -619,27 +614,42 @@ void zone_manager::cache_vzones()
             continue;
         }
 
-        const std::string &type_hash = elem->get_type_hash();
-        auto &cache = vzone_cache[type_hash];
-
-        // TODO: looks very similar to the above cache_data - maybe merge it?
+        vzone_cache[elem->get_type_hash()].emplace_back( elem->get_start_point(),
+                elem->get_end_point() );
+    }
+}
 
-        // Draw marked area
-        for( const tripoint &p : tripoint_range( elem->get_start_point(), elem->get_end_point() ) ) {
-            cache.insert( p );
-        }
+static const std::vector<box> &find_bounds( const
+        std::unordered_map<std::string, std::vector<box>> &cache, const zone_type_id &type,
+        const faction_id &fac )
+{
+    static const std::vector<box> no_bounds;
+    const auto &type_iter = cache.find( zone_data::make_type_hash( type, fac ) );
+    if( type_iter == cache.end() ) {
+        return no_bounds;
     }
+    return type_iter->second;
 }
 
-std::unordered_set<tripoint> zone_manager::get_point_set( const zone_type_id &type,
+std::array<const std::vector<box> *, 2> zone_manager::get_bounds( const zone_type_id &type,
         const faction_id &fac ) const
 {
-    const auto &type_iter = area_cache.find( zone_data::make_type_hash( type, fac ) );
-    if( type_iter == area_cache.end() ) {
-        return std::unordered_set<tripoint>();
-    }
+    return {{ &find_bounds( area_cache, type, fac ), &find_bounds( vzone_cache, type, fac ) }};
+}
 
-    return type_iter->second;
+/** The point of @p bounds closest to @p p, which is the clamped point for square distances. */
+static tripoint closest_point_in( const box &bounds, const tripoint &p )
+{
+    return tripoint( clamp( p.x, bounds.p_min.x, bounds.p_max.x ),
+                     clamp( p.y, bounds.p_min.y, bounds.p_max.y ),
+                     clamp( p.z, bounds.p_min.z, bounds.p_max.z ) );
+}
+
+/** Whether @p bounds has a point on the z-level of @p where within @p range of it. */
+static bool is_near( const box &bounds, const tripoint &where, int range )
+{
+    return where.z >= bounds.p_min.z && where.z <= bounds.p_max.z &&
+           square_dist( closest_point_in( bounds, where ), where ) <= range;
 }
 
 std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint &where,
@@ -651,11 +661,26 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint &w
 std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint &where,
         int radius, bool npc_search, const faction_id &/*fac*/ ) const
 {
+    // Only zones overlapping the searched area can be the topmost zone of any of its points,
+    // same order as in get_zone_at.
+    std::vector<const zone_data *> candidates;
+    for( auto it = zones.rbegin(); it != zones.rend(); ++it ) {
+        if( is_near( box( it->get_start_point(), it->get_end_point() ), where, radius ) ) {
+            candidates.push_back( &*it );
+        }
+    }
     std::unordered_set<tripoint> res;
+    if( candidates.empty() ) {
+        return res;
+    }
     for( const tripoint elem : g->m.points_in_radius( g->m.getlocal( where ), radius ) ) {
-        const zone_data *zone = get_zone_at( g->m.getabs( elem ) );
+        const tripoint abs_elem = g->m.getabs( elem );
+        const auto zone = std::find_if( candidates.begin(), candidates.end(),
+        [&abs_elem]( const zone_data * z ) {
+            return z->has_inside( abs_elem );
+        } );
         // if not a LOOT zone
-        if( ( !zone ) || ( zone->get_type().str().substr( 0, 4 ) != "LOOT" ) ) {
+        if( zone == candidates.end() || !string_starts_with( ( *zone )->get_type().str(), "LOOT" ) ) {
             continue;
         }
         if( npc_search && ( has( zone_NO_NPC_PICKUP, elem ) ) ) {
@@ -666,47 +691,29 @@ std::unordered_set<tripoint> zone_manager::get_point_set_loot( const tripoint &w
     return res;
 }
 
-std::unordered_set<tripoint> zone_manager::get_vzone_set( const zone_type_id &type,
-        const faction_id &fac ) const
-{
-    //Only regenerate the vehicle zone cache if any vehicles have moved
-    const auto &type_iter = vzone_cache.find( zone_data::make_type_hash( type, fac ) );
-    if( type_iter == vzone_cache.end() ) {
-        return std::unordered_set<tripoint>();
-    }
-
-    return type_iter->second;
-}
-
 bool zone_manager::has( const zone_type_id &type, const tripoint &where,
                         const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
-    const auto &vzone_set = get_vzone_set( type, fac );
-    return point_set.find( where ) != point_set.end() || vzone_set.find( where ) != vzone_set.end();
-}
-
-bool zone_manager::has_near( const zone_type_id &type, const tripoint &where, int range,
-                             const faction_id &fac ) const
-{
-    const auto &point_set = get_point_set( type, fac );
-    for( auto &point : point_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
+    for( const std::vector<box> *bounds : get_bounds( type, fac ) ) {
+        for( const box &b : *bounds ) {
+            if( b.contains_inclusive( where ) ) {
                 return true;
             }
         }
     }
+    return false;
+}
 
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( auto &point : vzone_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
+bool zone_manager::has_near( const zone_type_id &type, const tripoint &where, int range,
+                             const faction_id &fac ) const
+{
+    for( const std::vector<box> *bounds : get_bounds( type, fac ) ) {
+        for( const box &b : *bounds ) {
+            if( is_near( b, where, range ) ) {
                 return true;
             }
         }
     }
-
     return false;
 }
 
@@ -759,27 +766,18 @@ bool zone_manager::custom_loot_has( const tripoint &where, const item *it ) cons
 std::unordered_set<tripoint> zone_manager::get_near( const zone_type_id &type,
         const tripoint &where, int range, const item *it, const faction_id &fac ) const
 {
-    const auto &point_set = get_point_set( type, fac );
     auto near_point_set = std::unordered_set<tripoint>();
+    const box range_bounds( where - tripoint( range, range, 0 ), where + tripoint( range, range, 0 ) );
 
-    for( auto &point : point_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
-                if( it && has( zone_LOOT_CUSTOM, point ) ) {
-                    if( custom_loot_has( point, it ) ) {
-                        near_point_set.insert( point );
-                    }
-                } else {
-                    near_point_set.insert( point );
-                }
+    for( const std::vector<box> *bounds : get_bounds( type, fac ) ) {
+        for( const box &b : *bounds ) {
+            if( !is_near( b, where, range ) ) {
+                continue;
             }
-        }
-    }
-
-    const auto &vzone_set = get_vzone_set( type, fac );
-    for( auto &point : vzone_set ) {
-        if( point.z == where.z ) {
-            if( square_dist( point, where ) <= range ) {
+            const tripoint from = closest_point_in( b, range_bounds.p_min );
+            const tripoint to = closest_point_in( b, range_bounds.p_max );
+            for( const tripoint &point : tripoint_range( tripoint( from.xy(), where.z ),
+                    tripoint( to.xy(), where.z ) ) ) {
                 if( it && has( zone_LOOT_CUSTOM, point ) ) {
                     if( custom_loot_has( point, it ) ) {
                         near_point_set.insert( point );
@@ -803,26 +801,16 @@ cata::optional<tripoint> zone_manager::get_nearest( const zone_type_id &type, co
 
     tripoint nearest_pos = tripoint( INT_MIN, INT_MIN, INT_MIN );
     int nearest_dist = range + 1;
-    const std::unordered_set<tripoint> &point_set = get_point_set( type, fac );
-    for( const tripoint &p : point_set ) {
-        int cur_dist = square_dist( p, where );
-        if( cur_dist < nearest_dist ) {
-            nearest_dist = cur_dist;
-            nearest_pos = p;
-            if( nearest_dist == 0 ) {
-                return nearest_pos;
-            }
-        }
-    }
-
-    const std::unordered_set<tripoint> &vzone_set = get_vzone_set( type, fac );
-    for( const tripoint &p : vzone_set ) {
-        int cur_dist = square_dist( p, where );
-        if( cur_dist < nearest_dist ) {
-            nearest_dist = cur_dist;
-            nearest_pos = p;
-            if( nearest_dist == 0 ) {
-                return nearest_pos;
+    for( const std::vector<box> *bounds : get_bounds( type, fac ) ) {
+        for( const box &b : *bounds ) {
+            const tripoint p = closest_point_in( b, where );
+            int cur_dist = square_dist( p, where );
+            if( cur_dist < nearest_dist ) {
+                nearest_dist = cur_dist;
+                nearest_pos = p;
+                if( nearest_dist == 0 ) {
+                    return nearest_pos;
+                }
             }
         }
     }
@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_CLZONES_H
 #define CATA_SRC_CLZONES_H
 
+#include <array>
 #include <cstddef>
 #include <functional>
 #include <map>
@@ -357,11 +358,11 @@ class zone_manager
         std::vector<zone_data> removed_vzones;
 
         std::map<zone_type_id, zone_type> types;
-        std::unordered_map<std::string, std::unordered_set<tripoint>> area_cache;
-        std::unordered_map<std::string, std::unordered_set<tripoint>> vzone_cache;
-        std::unordered_set<tripoint> get_point_set( const zone_type_id &type,
-                const faction_id &fac = your_fac ) const;
-        std::unordered_set<tripoint> get_vzone_set( const zone_type_id &type,
+        // Bounds of the enabled zones, by type hash
+        std::unordered_map<std::string, std::vector<box>> area_cache;
+        std::unordered_map<std::string, std::vector<box>> vzone_cache;
+        // Bounds of the zones and of the vehicle zones of that type
+        std::array<const std::vector<box> *, 2> get_bounds( const zone_type_id &type,
                 const faction_id &fac = your_fac ) const;
 
         //Cache number of items already checked on each source tile when sorting
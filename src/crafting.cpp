@@ -545,6 +545,44 @@ const inventory &Character::crafting_inventory( bool clear_path )
     return crafting_inventory( tripoint_zero, PICKUP_RANGE, clear_path );
 }
 
+/**
+ * Whether nearby crafting sources can change without a change being stamped on the map
+ * (see @ref map::last_change_near): vehicles move and their tanks and batteries drain or charge,
+ * grids charge, fires burn out and active items other than rotting food transform on their own.
+ */
+static bool has_unstamped_sources( map &m, const inventory &nearby, const tripoint &origin,
+                                   int radius )
+{
+    const tripoint offset( radius, radius, 0 );
+    if( !m.get_vehicles( origin - offset, origin + offset ).empty() ) {
+        return true;
+    }
+    return nearby.has_item_with( []( const item & it ) {
+        return it.typeId() == "fire" || it.has_flag( "USES_GRID_POWER" ) ||
+               ( it.active && !it.has_rot_only_processing() );
+    } );
+}
+
+bool Character::update_nearby_inventory( const tripoint &inv_pos, int radius, bool clear_path )
+{
+    map &here = get_map();
+    const tripoint abs_pos = here.getabs( inv_pos );
+    const uint64_t last_change = here.last_change_near( inv_pos, radius );
+    if( cached_nearby_radius == radius && cached_nearby_clear_path == clear_path &&
+        cached_nearby_position == abs_pos && cached_nearby_change >= last_change &&
+        ( cached_nearby_time == calendar::turn ||
+          !has_unstamped_sources( here, cached_nearby_inventory, inv_pos, radius ) ) ) {
+        return false;
+    }
+    cached_nearby_inventory.form_from_map( here, inv_pos, radius, this, false, clear_path );
+    cached_nearby_position = abs_pos;
+    cached_nearby_radius = radius;
+    cached_nearby_clear_path = clear_path;
+    cached_nearby_change = last_change;
+    cached_nearby_time = calendar::turn;
+    return true;
+}
+
 const inventory &Character::crafting_inventory( const tripoint &src_pos, int radius,
         bool clear_path )
 {
@@ -552,12 +590,11 @@ const inventory &Character::crafting_inventory( const tripoint &src_pos, int rad
     if( src_pos == tripoint_zero ) {
         inv_pos = pos();
     }
-    if( cached_moves == moves
-        && cached_time == calendar::turn
-        && cached_position == inv_pos ) {
+    const bool nearby_changed = update_nearby_inventory( inv_pos, radius, clear_path );
+    if( !nearby_changed && cached_moves == moves && cached_time == calendar::turn ) {
         return cached_crafting_inventory;
     }
-    cached_crafting_inventory.form_from_map( inv_pos, radius, this, false, clear_path );
+    cached_crafting_inventory = cached_nearby_inventory;
     cached_crafting_inventory += inv;
     cached_crafting_inventory += weapon;
     cached_crafting_inventory += worn;
@@ -576,13 +613,13 @@ const inventory &Character::crafting_inventory( const tripoint &src_pos, int rad
 
     cached_moves = moves;
     cached_time = calendar::turn;
-    cached_position = inv_pos;
     return cached_crafting_inventory;
 }
 
 void Character::invalidate_crafting_inventory()
 {
     cached_time = calendar::before_time_starts;
+    cached_nearby_radius = -1;
 }
 
 void player::make_craft( const recipe_id &id_to_make, int batch_size, const tripoint &loc )
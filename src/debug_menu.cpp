@@ -51,6 +51,7 @@
 #include "magic.h"
 #include "map.h"
 #include "map_extras.h"
+#include "mapbuffer.h"
 #include "mapgen.h"
 #include "mapgendata.h"
 #include "martialarts.h"
@@ -179,7 +180,8 @@ enum debug_menu_index {
     DEBUG_TEST_MAP_EXTRA_DISTRIBUTION,
     DEBUG_VEHICLE_BATTERY_CHARGE,
     DEBUG_HOUR_TIMER,
-    DEBUG_NESTED_MAPGEN
+    DEBUG_NESTED_MAPGEN,
+    DEBUG_MAP_MEMORY
 };
 
 class mission_debug
@@ -256,6 +258,7 @@ static int info_uilist( bool display_all_entries = true )
             { uilist_entry( DEBUG_PRINT_NPC_MAGIC, true, 'M', _( "Print NPC magic info to console" ) ) },
             { uilist_entry( DEBUG_TEST_WEATHER, true, 'W', _( "Test weather" ) ) },
             { uilist_entry( DEBUG_TEST_MAP_EXTRA_DISTRIBUTION, true, 'e', _( "Test map extra list" ) ) },
+            { uilist_entry( DEBUG_MAP_MEMORY, true, 'U', _( "Show map memory usage" ) ) },
         };
         uilist_initializer.insert( uilist_initializer.begin(), debug_only_options.begin(),
                                    debug_only_options.end() );
@@ -1258,11 +1261,9 @@ void debug()
 
         case DEBUG_REVEAL_MAP: {
             auto &cur_om = g->get_cur_om();
-            for( int i = 0; i < OMAPX; i++ ) {
+            for( int k = -OVERMAP_DEPTH; k <= OVERMAP_HEIGHT; k++ ) {
                 for( int j = 0; j < OMAPY; j++ ) {
-                    for( int k = -OVERMAP_DEPTH; k <= OVERMAP_HEIGHT; k++ ) {
-                        cur_om.seen( { i, j, k } ) = true;
-                    }
+                    cur_om.reveal_row( { 0, j, k }, OMAPX );
                 }
             }
             add_msg( m_good, _( "Current overmap revealed." ) );
@@ -1821,6 +1822,23 @@ void debug()
         case DEBUG_NESTED_MAPGEN:
             debug_menu::spawn_nested_mapgen();
             break;
+        case DEBUG_MAP_MEMORY: {
+            const auto describe = []( size_t count, size_t bytes ) {
+                return string_format( "%d (%.1f MiB)", count, bytes / ( 1024.0 * 1024.0 ) );
+            };
+            const std::string usage = string_format(
+                                          _( "Overmaps loaded: %s\nOvermaps unloaded: %s\n"
+                                             "Submaps loaded: %s\nSubmaps unloaded: %s\n\n"
+                                             "Unload all unused maps now?" ),
+                                          describe( overmap_buffer.resident_count(), overmap_buffer.resident_bytes() ),
+                                          describe( overmap_buffer.evicted_count(), overmap_buffer.evicted_bytes() ),
+                                          describe( MAPBUFFER.resident_count(), MAPBUFFER.resident_bytes() ),
+                                          describe( MAPBUFFER.evicted_count(), MAPBUFFER.evicted_bytes() ) );
+            if( query_yn( usage ) ) {
+                g->unload_cold_maps( true );
+            }
+            break;
+        }
         case DEBUG_DISPLAY_NPC_PATH:
             g->debug_pathfinding = !g->debug_pathfinding;
             break;
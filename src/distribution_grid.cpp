@@ -44,23 +44,78 @@ distribution_grid::operator bool() const
     return !empty() && !submap_coords.empty();
 }
 
-void distribution_grid::update( time_point to )
+void distribution_grid::refresh_resolved() const
 {
+    bool changed = false;
     for( const std::pair<const tripoint, std::vector<tile_location>> &c : contents ) {
         submap *sm = mb.lookup_submap( c.first );
+        submap_tiles &cached = resolved[c.first];
+        if( sm != nullptr && sm == cached.sm && sm->last_change == cached.last_change ) {
+            continue;
+        }
+        changed = true;
+        cached = submap_tiles();
         if( sm == nullptr ) {
+            continue;
+        }
+        cached.sm = sm;
+        cached.last_change = sm->last_change;
+        for( const tile_location &loc : c.second ) {
+            const auto iter = sm->active_furniture.find( loc.on_submap );
+            if( iter == sm->active_furniture.end() ) {
+                cached.tiles.emplace_back( loc.absolute, nullptr );
+                continue;
+            }
+            active_tile_data *active = &*iter->second;
+            cached.tiles.emplace_back( loc.absolute, active );
+            if( battery_tile *battery = dynamic_cast<battery_tile *>( active ) ) {
+                cached.batteries.push_back( battery );
+            } else if( vehicle_connector_tile *connector = dynamic_cast<vehicle_connector_tile *>
+                       ( active ) ) {
+                cached.connectors.push_back( connector );
+            }
+        }
+    }
+
+    if( changed ) {
+        capacity_total = 0;
+        for( const std::pair<const tripoint, submap_tiles> &pr : resolved ) {
+            for( const battery_tile *battery : pr.second.batteries ) {
+                capacity_total += battery->max_stored;
+            }
+        }
+    }
+    if( changed || stored_generation != battery_tile::charge_generation ) {
+        stored_total = 0;
+        for( const std::pair<const tripoint, submap_tiles> &pr : resolved ) {
+            for( const battery_tile *battery : pr.second.batteries ) {
+                stored_total += battery->get_resource();
+            }
+        }
+        stored_generation = battery_tile::charge_generation;
+    }
+}
+
+void distribution_grid::update( time_point to )
+{
+    refresh_resolved();
+    for( const std::pair<const tripoint, std::vector<tile_location>> &c : contents ) {
+        const submap_tiles &cached = resolved[c.first];
+        if( cached.sm == nullptr ) {
             return;
         }
 
-        for( const tile_location &loc : c.second ) {
-            auto &active = sm->active_furniture[loc.on_submap];
-            if( !active ) {
+        // Copied, updating the tiles refreshes the resolved tiles through mod_resource
+        const std::vector<std::pair<tripoint, active_tile_data *>> tiles = cached.tiles;
+        for( const std::pair<tripoint, active_tile_data *> &tile : tiles ) {
+            if( tile.second == nullptr ) {
                 debugmsg( "No active furniture at %d,%d,%d",
-                          loc.absolute.x, loc.absolute.y, loc.absolute.z );
+                          tile.first.x, tile.first.y, tile.first.z );
                 contents.clear();
+                resolved.clear();
                 return;
             }
-            active->update( to, loc.absolute, *this );
+            tile.second->update( to, tile.first, *this );
         }
     }
 }
@@ -68,39 +123,49 @@ void distribution_grid::update( time_point to )
 // TODO: Shouldn't be here
 #include "vehicle.h"
 static itype_id itype_battery( "battery" );
-int distribution_grid::mod_resource( int amt, bool recurse )
+
+static std::vector<vehicle *> find_connected_vehicles( const
+        std::vector<vehicle_connector_tile *> &connectors )
 {
     std::vector<vehicle *> connected_vehicles;
-    for( const std::pair<const tripoint, std::vector<tile_location>> &c : contents ) {
-        for( const tile_location &loc : c.second ) {
-            battery_tile *battery = active_tiles::furn_at<battery_tile>( loc.absolute );
-            if( battery != nullptr ) {
-                amt = battery->mod_resource( amt );
-                if( amt == 0 ) {
-                    return 0;
-                }
-                continue;
-            }
-
-            if( !recurse ) {
+    for( const vehicle_connector_tile *connector : connectors ) {
+        for( const tripoint &veh_abs : connector->connected_vehicles ) {
+            vehicle *veh = vehicle::find_vehicle( veh_abs );
+            if( veh == nullptr ) {
+                // TODO: Disconnect
+                debugmsg( "lost vehicle at %d,%d,%d", veh_abs.x, veh_abs.y, veh_abs.z );
                 continue;
             }
+            connected_vehicles.push_back( veh );
+        }
+    }
+    return connected_vehicles;
+}
 
-            vehicle_connector_tile *connector = active_tiles::furn_at<vehicle_connector_tile>( loc.absolute );
-            if( connector != nullptr ) {
-                for( const tripoint &veh_abs : connector->connected_vehicles ) {
-                    vehicle *veh = vehicle::find_vehicle( veh_abs );
-                    if( veh == nullptr ) {
-                        // TODO: Disconnect
-                        debugmsg( "lost vehicle at %d,%d,%d", veh_abs.x, veh_abs.y, veh_abs.z );
-                        continue;
-                    }
-                    connected_vehicles.push_back( veh );
+int distribution_grid::mod_resource( int amt, bool recurse )
+{
+    refresh_resolved();
+    // Skip the batteries when none of them could take or give anything
+    const bool batteries_usable = amt > 0 ? stored_total < capacity_total : stored_total > 0;
+    std::vector<vehicle_connector_tile *> connectors;
+    for( const std::pair<const tripoint, submap_tiles> &pr : resolved ) {
+        if( batteries_usable ) {
+            for( battery_tile *battery : pr.second.batteries ) {
+                const int before = battery->get_resource();
+                amt = battery->mod_resource( amt );
+                stored_total += battery->get_resource() - before;
+                stored_generation = battery_tile::charge_generation;
+                if( amt == 0 ) {
+                    return 0;
                 }
             }
         }
+        if( recurse ) {
+            connectors.insert( connectors.end(), pr.second.connectors.begin(), pr.second.connectors.end() );
+        }
     }
 
+    const std::vector<vehicle *> connected_vehicles = find_connected_vehicles( connectors );
     // TODO: Giga ugly. We only charge the first vehicle to get it to use its recursive graph traversal because it's inaccessible from here due to being a template method
     if( !connected_vehicles.empty() ) {
         if( amt > 0 ) {
@@ -115,41 +180,28 @@ int distribution_grid::mod_resource( int amt, bool recurse )
 
 int distribution_grid::get_resource( bool recurse ) const
 {
-    int res = 0;
-    std::vector<vehicle *> connected_vehicles;
-    for( const std::pair<const tripoint, std::vector<tile_location>> &c : contents ) {
-        for( const tile_location &loc : c.second ) {
-            battery_tile *battery = active_tiles::furn_at<battery_tile>( loc.absolute );
-            if( battery != nullptr ) {
-                res += battery->get_resource();
-                continue;
-            }
-
-            if( !recurse ) {
-                continue;
-            }
-
-            vehicle_connector_tile *connector = active_tiles::furn_at<vehicle_connector_tile>( loc.absolute );
-            if( connector != nullptr ) {
-                for( const tripoint &veh_abs : connector->connected_vehicles ) {
-                    vehicle *veh = vehicle::find_vehicle( veh_abs );
-                    if( veh == nullptr ) {
-                        // TODO: Disconnect
-                        debugmsg( "lost vehicle at %d,%d,%d", veh_abs.x, veh_abs.y, veh_abs.z );
-                        continue;
-                    }
-                    connected_vehicles.push_back( veh );
-                }
-            }
-        }
+    refresh_resolved();
+    if( !recurse ) {
+        return stored_total;
     }
 
+    std::vector<vehicle_connector_tile *> connectors;
+    for( const std::pair<const tripoint, submap_tiles> &pr : resolved ) {
+        connectors.insert( connectors.end(), pr.second.connectors.begin(), pr.second.connectors.end() );
+    }
+    const std::vector<vehicle *> connected_vehicles = find_connected_vehicles( connectors );
     // TODO: Giga ugly. We only charge the first vehicle to get it to use its recursive graph traversal because it's inaccessible from here due to being a template method
     if( !connected_vehicles.empty() ) {
-        res = connected_vehicles.front()->fuel_left( itype_battery, true );
+        return connected_vehicles.front()->fuel_left( itype_battery, true );
     }
 
-    return res;
+    return stored_total;
+}
+
+int distribution_grid::get_capacity() const
+{
+    refresh_resolved();
+    return capacity_total;
 }
 
 distribution_grid_tracker::distribution_grid_tracker()
@@ -220,6 +272,15 @@ void distribution_grid_tracker::on_changed( const tripoint &p )
 
 }
 
+std::set<tripoint> distribution_grid_tracker::tracked_submaps() const
+{
+    std::set<tripoint> result;
+    for( const auto &elem : parent_distribution_grids ) {
+        result.insert( elem.first );
+    }
+    return result;
+}
+
 void distribution_grid_tracker::on_options_changed()
 {
     on_saved();
@@ -3,15 +3,21 @@
 #define CATA_SRC_DISTRIBUTION_GRID_H
 
 #include <cstdint>
-#include <vector>
 #include <map>
+#include <set>
+#include <utility>
+#include <vector>
 
 #include "calendar.h"
 #include "memory_fast.h"
 #include "point.h"
 
+class active_tile_data;
+class battery_tile;
 class map;
 class mapbuffer;
+class submap;
+class vehicle_connector_tile;
 
 struct tile_location {
     point on_submap;
@@ -41,6 +47,33 @@ class distribution_grid
         std::vector<tripoint> flat_contents;
         std::vector<tripoint> submap_coords;
 
+        /**
+         * The active tiles of one submap in @ref contents, resolved once instead of
+         * looked up by position on every query.
+         */
+        struct submap_tiles {
+            const submap *sm = nullptr;
+            /** @ref submap::last_change when the tiles were resolved */
+            uint64_t last_change = 0;
+            /** Absolute position and data of each tile, nullptr if the tile is gone */
+            std::vector<std::pair<tripoint, active_tile_data *>> tiles;
+            std::vector<battery_tile *> batteries;
+            std::vector<vehicle_connector_tile *> connectors;
+        };
+        mutable std::map<tripoint, submap_tiles> resolved;
+        /** Charge stored in and capacity of all batteries in @ref resolved, in kJ */
+        mutable int stored_total = 0;
+        mutable int capacity_total = 0;
+        /** @ref battery_tile::charge_generation that @ref stored_total is up to date with */
+        mutable uint64_t stored_generation = 0;
+
+        /**
+         * Re-resolves the tiles of the submaps that were changed or reloaded since the
+         * last call, and recounts the totals if any were or if a battery was charged or
+         * discharged by something other than this grid.
+         */
+        void refresh_resolved() const;
+
         mapbuffer &mb;
 
     public:
@@ -50,6 +83,8 @@ class distribution_grid
         void update( time_point to );
         int mod_resource( int amt, bool recurse = true );
         int get_resource( bool recurse = true ) const;
+        /** Total capacity of the batteries in this grid, not counting connected vehicles. */
+        int get_capacity() const;
         const std::vector<tripoint> &get_contents() const {
             return flat_contents;
         }
@@ -110,6 +145,10 @@ class distribution_grid_tracker
          * Updates grid at given global map square coordinate.
          */
         void on_changed( const tripoint &p );
+        /**
+         * Submap coords of every submap that belongs to a tracked grid.
+         */
+        std::set<tripoint> tracked_submaps() const;
         void on_saved();
         void on_options_changed();
 };
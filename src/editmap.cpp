@@ -1,7 +1,6 @@
 #include "editmap.h"
 
 #include <cstdlib>
-#include <cstring>
 #include <exception>
 #include <iosfwd>
 #include <map>
@@ -2120,9 +2119,8 @@ void editmap::cleartmpmap( tinymap &tmpmap )
         smap = nullptr;
     }
 
+    tmpmap.clear_vehicle_cache( target.z );
     auto &ch = tmpmap.get_cache( target.z );
-    std::memset( ch.veh_exists_at, 0, sizeof( ch.veh_exists_at ) );
-    ch.veh_cached_parts.clear();
     ch.vehicle_list.clear();
     ch.zone_vehicles.clear();
 }
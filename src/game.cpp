@@ -1397,6 +1397,10 @@ bool game::do_turn()
 
     u.update_body();
 
+    if( calendar::once_every( 10_minutes ) ) {
+        unload_cold_maps();
+    }
+
     // Auto-save if autosave is enabled
     if( get_option<bool>( "AUTOSAVE" ) &&
         calendar::once_every( 1_turns * get_option<int>( "AUTOSAVE_TURNS" ) ) &&
@@ -11562,6 +11566,27 @@ void game::autosave()
     quicksave();    //Driving checks are handled by quicksave()
 }
 
+void game::unload_cold_maps( bool everything )
+{
+    size_t budget = 0;
+    if( !everything ) {
+        const int budget_mb = get_option<int>( "MAP_MEMORY_BUDGET" );
+        if( budget_mb <= 0 ) {
+            return;
+        }
+        budget = static_cast<size_t>( budget_mb ) * 1024 * 1024;
+    }
+    try {
+        // Submaps are cheaper to load again, so they go first
+        const size_t overmap_bytes = overmap_buffer.resident_bytes();
+        MAPBUFFER.unload_cold( budget > overmap_bytes ? budget - overmap_bytes : 0 );
+        const size_t submap_bytes = MAPBUFFER.resident_bytes();
+        overmap_buffer.unload_cold( budget > submap_bytes ? budget - submap_bytes : 0 );
+    } catch( const std::exception &err ) {
+        debugmsg( "Failed to unload the maps: %s", err.what() );
+    }
+}
+
 void game::process_artifact( item &it, player &p )
 {
     const bool worn = p.is_worn( it );
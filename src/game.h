@@ -916,6 +916,12 @@ class game
         void autosave();         // automatic quicksaves - Performs some checks before calling quicksave()
     public:
         void quicksave();        // Saves the game without quitting
+        /**
+         * Unloads the overmaps and submaps used least recently while they exceed the
+         * "MAP_MEMORY_BUDGET" option, see @ref mapbuffer::unload_cold.
+         * @param everything Unload all of them that may be unloaded, ignoring the budget.
+         */
+        void unload_cold_maps( bool everything = false );
         void disp_NPCs();        // Currently for debug use.  Lists global NPCs.
 
         void list_missions();       // Listed current, completed and failed missions (mission_ui.cpp)
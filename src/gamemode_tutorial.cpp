@@ -128,7 +128,7 @@ bool tutorial_game::init()
             tripoint p( i, j, 0 );
             starting_om.ter_set( p + tripoint_below, rock );
             // Start with the overmap revealed
-            starting_om.seen( p ) = true;
+            starting_om.set_seen( p, true );
         }
     }
     starting_om.ter_set( lp, oter_id( "tutorial" ) );
@@ -116,6 +116,7 @@ bool handle_liquid_from_ground( map_stack::iterator on_ground,
 {
     // TODO: not all code paths on handle_liquid consume move points, fix that.
     handle_liquid( *on_ground, nullptr, radius, &pos );
+    g->m.mark_changed( pos );
     if( on_ground->charges > 0 ) {
         return false;
     }
@@ -3173,6 +3173,7 @@ void iexamine::keg( player &p, const tripoint &examp )
                 if( !p.eat( drink ) ) {
                     return; // They didn't actually drink
                 }
+                g->m.mark_changed( examp );
 
                 if( drink.charges == 0 ) {
                     add_msg( _( "You squeeze the last drops of %1$s from the %2$s." ),
@@ -3247,6 +3248,7 @@ bool iexamine::pour_into_keg( const tripoint &pos, item &liquid )
         drink.charges++;
         liquid.charges--;
     }
+    g->m.mark_changed( pos );
     return true;
 }
 
@@ -3426,6 +3428,7 @@ void iexamine::tree_maple_tapped( player &p, const tripoint &examp )
 
         case HARVEST_SAP: {
             liquid_handler::handle_liquid_from_container( *container, PICKUP_RANGE );
+            g->m.mark_changed( examp );
             return;
         }
 
@@ -1150,6 +1150,7 @@ const itype_bin &inventory::get_binned_items() const
     }
 
     binned_items.clear();
+    quality_amounts.clear();
 
     // HACK: Hack warning
     inventory *this_nonconst = const_cast<inventory *>( this );
@@ -16,6 +16,7 @@
 #include <vector>
 
 #include "item.h"
+#include "type_id.h"
 #include "units.h"
 #include "visitable.h"
 
@@ -243,6 +244,12 @@ class inventory : public visitable<inventory>
          * `mutable` because this is a pure cache that doesn't affect the contained items.
          */
         mutable itype_bin binned_items;
+        /**
+         * Number of items having at least a given level of a quality, memoized for
+         * @ref visitable::has_quality. Cleared along with @ref binned_items, as every change
+         * to the inventory forces those to be rebuilt.
+         */
+        mutable std::map<std::pair<quality_id, int>, int> quality_amounts;
 };
 
 #endif // CATA_SRC_INVENTORY_H
@@ -10,6 +10,7 @@
 #include <iterator>
 #include <limits>
 #include <locale>
+#include <map>
 #include <memory>
 #include <set>
 #include <sstream>
@@ -319,8 +320,36 @@ struct scoped_goes_bad_cache {
         goes_bad_cache_unset();
     }
 };
+
+struct tname_cache_key {
+    const item *it;
+    // Guards against reuse of the address by a different kind of item
+    const itype *type;
+    unsigned int quantity;
+    bool with_prefix;
+    unsigned int truncate;
+
+    bool operator<( const tname_cache_key &rhs ) const {
+        return std::tie( it, type, quantity, with_prefix, truncate ) <
+               std::tie( rhs.it, rhs.type, rhs.quantity, rhs.with_prefix, rhs.truncate );
+    }
+};
+int tname_cache_depth = 0;
+std::map<tname_cache_key, std::string> tname_cache;
 } // namespace item_internal
 
+scoped_tname_cache::scoped_tname_cache()
+{
+    ++item_internal::tname_cache_depth;
+}
+
+scoped_tname_cache::~scoped_tname_cache()
+{
+    if( --item_internal::tname_cache_depth == 0 ) {
+        item_internal::tname_cache.clear();
+    }
+}
+
 const int item::INFINITE_CHARGES = INT_MAX;
 
 item::item() : bday( calendar::start_of_cataclysm )
@@ -4214,6 +4243,22 @@ void item::on_damage( int, damage_type )
 }
 
 std::string item::tname( unsigned int quantity, bool with_prefix, unsigned int truncate ) const
+{
+    if( item_internal::tname_cache_depth == 0 ) {
+        return tname_uncached( quantity, with_prefix, truncate );
+    }
+    const item_internal::tname_cache_key key{ this, type, quantity, with_prefix, truncate };
+    const auto cached = item_internal::tname_cache.find( key );
+    if( cached != item_internal::tname_cache.end() ) {
+        return cached->second;
+    }
+    std::string name = tname_uncached( quantity, with_prefix, truncate );
+    item_internal::tname_cache.emplace( key, name );
+    return name;
+}
+
+std::string item::tname_uncached( unsigned int quantity, bool with_prefix,
+                                  unsigned int truncate ) const
 {
     int dirt_level = get_var( "dirt", 0 ) / 2000;
     std::string dirt_symbol;
@@ -8456,9 +8501,49 @@ int item::processing_speed() const
     return 1;
 }
 
+// process rot at most once every 100_turns (10 min)
+// note we're also gated by item::processing_speed
+static constexpr time_duration rot_update_interval = 10_minutes;
+
+bool item::is_rot_update_due() const
+{
+    const time_duration since_last_check = calendar::turn - last_rot_check;
+    return since_last_check < 0_turns || since_last_check > rot_update_interval;
+}
+
 bool item::process_rot( float /*insulation*/, const bool seals,
                         const tripoint &pos,
                         player *carrier, const temperature_flag flag )
+{
+    if( !is_rot_update_due() ) {
+        // Nothing would change, skip the temperature and carrier lookups.
+        return false;
+    }
+    const bool carried = carrier != nullptr && carrier->has_item( *this );
+    return process_rot_internal( g->weather.get_temperature( pos ), seals, pos, carrier, carried,
+                                 flag );
+}
+
+bool item::process_rot_with_temperature( int env_temp, const tripoint &pos,
+        const temperature_flag flag )
+{
+    return process_rot_internal( env_temp, false, pos, nullptr, false, flag );
+}
+
+bool item::has_rot_only_processing() const
+{
+    // Has to mirror process() and process_internal(): anything that may do more
+    // than accumulating rot must be processed the regular way.
+    return active && is_food() && contents.empty() && faults.empty() && !is_tool() &&
+           type->container == nullptr && type->emits.empty() && !type->countdown_action &&
+           !has_flag( flag_ETHEREAL_ITEM ) && !has_flag( flag_FAKE_SMOKE ) &&
+           !has_flag( flag_FAKE_MILL ) && !has_flag( flag_WET ) && !has_flag( flag_LITCIG ) &&
+           !has_flag( flag_WATER_EXTINGUISH ) && !has_flag( flag_WIND_EXTINGUISH ) &&
+           !has_flag( flag_CABLE_SPOOL ) && !has_flag( flag_IS_UPS );
+}
+
+bool item::process_rot_internal( int temp, const bool seals, const tripoint &pos,
+                                 player *carrier, const bool carried, const temperature_flag flag )
 {
     const time_point now = calendar::turn;
 
@@ -8469,12 +8554,6 @@ bool item::process_rot( float /*insulation*/, const bool seals,
         return false;
     }
 
-    // process rot at most once every 100_turns (10 min)
-    // note we're also gated by item::processing_speed
-    time_duration smallest_interval = 10_minutes;
-
-    int temp = g->weather.get_temperature( pos );
-
     switch( flag ) {
         case TEMP_NORMAL:
             // Just use the temperature normally
@@ -8495,7 +8574,6 @@ bool item::process_rot( float /*insulation*/, const bool seals,
             debugmsg( "Temperature flag enum not valid.  Using current temperature." );
     }
 
-    bool carried = carrier != nullptr && carrier->has_item( *this );
     // body heat increases inventory temperature by 5F
     if( carried ) {
         temp += 5;
@@ -8505,10 +8583,9 @@ bool item::process_rot( float /*insulation*/, const bool seals,
     item_internal::scoped_goes_bad_cache _cache( this );
 
     if( now - time > 1_hours ) {
-        // This code is for items that were left out of reality bubble for long time
-
-        const weather_generator &wgen = g->weather.get_cur_weather_gen();
-        const unsigned int seed = g->get_seed();
+        // This code is for items that were left out of reality bubble for long time.
+        // The past is processed in steps ending on full hours, so the weather temperature
+        // of each hour is looked up once and shared by all items lying at the same spot.
         int local_mod = g->new_game ? 0 : g->m.get_temperature( pos );
 
         if( carried ) {
@@ -8518,13 +8595,14 @@ bool item::process_rot( float /*insulation*/, const bool seals,
         // Process the past of this item since the last time it was processed
         while( now - time > 1_hours ) {
             // Get the environment temperature
-            time_duration time_delta = std::min( 1_hours, now - 1_hours - time );
-            time += time_delta;
+            const time_point next_hour = time - ( time - calendar::turn_zero ) % 1_hours + 1_hours;
+            time = std::min( next_hour, now - 1_hours );
+            const time_point hour = time - ( time - calendar::turn_zero ) % 1_hours;
 
             //Use weather if above ground, use map temp if below
             double env_temperature = 0;
             if( pos.z >= 0 ) {
-                double weather_temperature = wgen.get_weather_temperature( pos, time, seed );
+                double weather_temperature = g->weather.get_hourly_weather_temperature( pos, hour );
                 env_temperature = weather_temperature + local_mod;
             } else {
                 env_temperature = AVERAGE_ANNUAL_TEMPERATURE + local_mod;
@@ -8562,7 +8640,7 @@ bool item::process_rot( float /*insulation*/, const bool seals,
 
     // Remaining <1 h from above
     // and items that are held near the player
-    if( now - time > smallest_interval ) {
+    if( now - time > rot_update_interval ) {
         calc_rot( now, temp );
 
         return has_rotten_away() && carrier == nullptr && !seals;
@@ -335,6 +335,9 @@ class item : public visitable<item>
          */
         std::string tname( unsigned int quantity = 1, bool with_prefix = true,
                            unsigned int truncate = 0 ) const;
+        /** Same as @ref tname, but never uses the @ref scoped_tname_cache */
+        std::string tname_uncached( unsigned int quantity = 1, bool with_prefix = true,
+                                    unsigned int truncate = 0 ) const;
         std::string display_money( unsigned int quantity, unsigned int total,
                                    const cata::optional<unsigned int> &selected = cata::nullopt ) const;
         /**
@@ -785,6 +788,24 @@ class item : public visitable<item>
          */
         bool process_rot( float insulation, bool seals, const tripoint &pos,
                           player *carrier, temperature_flag flag = temperature_flag::TEMP_NORMAL );
+        /**
+         * Same as @ref process_rot for an item lying uncarried and unsealed at @p pos,
+         * but with the environment temperature already looked up by the caller.
+         * Used to process many items sharing a tile without repeating the lookup.
+         * @param env_temp Temperature at pos, before applying @p flag
+         */
+        bool process_rot_with_temperature( int env_temp, const tripoint &pos,
+                                           temperature_flag flag = temperature_flag::TEMP_NORMAL );
+        /**
+         * Whether @ref process would do nothing for this item except rotting it,
+         * which allows processing it in bulk with @ref process_rot_with_temperature.
+         */
+        bool has_rot_only_processing() const;
+        /**
+         * Whether enough time passed since the last rot calculation for @ref process_rot
+         * to do anything. Until then, processing rot is a no-op.
+         */
+        bool is_rot_update_due() const;
 
         int get_comestible_fun() const;
 
@@ -2093,6 +2114,8 @@ class item : public visitable<item>
         const use_function *get_use_internal( const std::string &use_name ) const;
         bool process_internal( player *carrier, const tripoint &pos, bool activate, float insulation = 1,
                                bool seals = false, temperature_flag flag = temperature_flag::TEMP_NORMAL );
+        bool process_rot_internal( int temp, bool seals, const tripoint &pos, player *carrier,
+                                   bool carried, temperature_flag flag );
 
         /** Helper for checking reloadability. **/
         bool is_reloadable_helper( const itype_id &ammo, bool now ) const;
@@ -2218,6 +2241,22 @@ class item : public visitable<item>
         void update_clothing_mod_val();
 };
 
+/**
+ * Memoizes item::tname() results while an instance is alive.
+ * Meant for UI code that builds, filters, sorts and draws a list of many items in one go,
+ * where the same names would otherwise be rebuilt over and over.
+ * Nothing invalidates the cached names, so none of the listed items may be modified
+ * while in scope. Scopes may nest, the cache is dropped when the outermost one ends.
+ */
+class scoped_tname_cache
+{
+    public:
+        scoped_tname_cache();
+        ~scoped_tname_cache();
+        scoped_tname_cache( const scoped_tname_cache & ) = delete;
+        scoped_tname_cache &operator=( const scoped_tname_cache & ) = delete;
+};
+
 bool item_compare_by_charges( const item &left, const item &right );
 bool item_ptr_compare_by_charges( const item *left, const item *right );
 
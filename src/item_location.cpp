@@ -87,6 +87,8 @@ class item_location::impl
         virtual void remove_item() = 0;
         virtual void serialize( JsonOut &js ) const = 0;
         virtual item *unpack( int ) const = 0;
+        /** Stamps where the item is as changed, see @ref map::mark_changed. */
+        virtual void mark_changed() {}
 
         item *target() const {
             ensure_unpacked();
@@ -189,6 +191,10 @@ class item_location::impl::item_on_map : public item_location::impl
             return cur;
         }
 
+        void mark_changed() override {
+            g->m.mark_changed( cur );
+        }
+
         std::string describe( const Character *ch ) const override {
             std::string res = g->m.name( cur );
             if( ch ) {
@@ -199,6 +205,7 @@ class item_location::impl::item_on_map : public item_location::impl
 
         item_location obtain( Character &ch, int qty ) override {
             ch.moves -= obtain_cost( ch, qty );
+            mark_changed();
 
             item obj = target()->split( qty );
             if( !obj.is_null() ) {
@@ -556,6 +563,10 @@ class item_location::impl::item_in_container : public item_location::impl
             return container.position();
         }
 
+        void mark_changed() override {
+            container.ptr->mark_changed();
+        }
+
         void remove_item() override {
             container->remove_item( *target() );
         }
@@ -616,6 +627,7 @@ item_location::operator bool() const
 
 item &item_location::operator*()
 {
+    ptr->mark_changed();
     return *ptr->target();
 }
 
@@ -626,6 +638,7 @@ const item &item_location::operator*() const
 
 item *item_location::operator->()
 {
+    ptr->mark_changed();
     return ptr->target();
 }
 
@@ -730,6 +743,7 @@ void item_location::remove_item()
 
 item *item_location::get_item()
 {
+    ptr->mark_changed();
     return ptr->target();
 }
 
@@ -82,6 +82,19 @@ std::function<bool( const item & )> item_filter_from_string( const std::string &
     return filter_from_string<item>( filter, basic_item_filter );
 }
 
+bool is_name_only_filter( const std::string &filter )
+{
+    return !filter.empty() && filter[0] != '-' && filter.find_first_of( ",:{}" ) == std::string::npos;
+}
+
+bool filter_narrows( const std::string &broader, const std::string &narrower )
+{
+    // Names are matched by case insensitive substring search: any name containing
+    // the narrower query also contains the broader one if that is part of it.
+    return is_name_only_filter( broader ) && is_name_only_filter( narrower ) &&
+           lcmatch( narrower, broader );
+}
+
 std::pair<std::string, std::string> get_both( const std::string &a )
 {
     size_t split_mark = a.find( ';' );
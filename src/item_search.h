@@ -96,4 +96,16 @@ std::function<bool( const item & )> item_filter_from_string( const std::string &
  */
 std::function<bool( const item & )> basic_item_filter( std::string filter );
 
+/**
+ * Whether the query only looks at item names (no prefixes like "c:", no alternatives
+ * or exclusions), so its result for an item only depends on item::tname().
+ */
+bool is_name_only_filter( const std::string &filter );
+
+/**
+ * Whether every item matching @p narrower is guaranteed to also match @p broader,
+ * e.g. "rifl" narrows "ri". Only name queries are considered, see @ref is_name_only_filter.
+ */
+bool filter_narrows( const std::string &broader, const std::string &narrower );
+
 #endif // CATA_SRC_ITEM_SEARCH_H
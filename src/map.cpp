@@ -232,6 +232,51 @@ void map::reset_vehicle_cache( const int zlev )
     }
 }
 
+namespace
+{
+
+// Marks a tile held by a moving vehicle until the vehicle claims it again
+constexpr uint16_t stale_vpart = UINT16_MAX;
+
+uint16_t acquire_veh_cache_slot( level_cache &ch, vehicle *veh )
+{
+    const auto found = ch.veh_cache_slot_of.find( veh );
+    if( found != ch.veh_cache_slot_of.end() ) {
+        return found->second;
+    }
+    uint16_t id;
+    if( !ch.free_veh_cache_slots.empty() ) {
+        id = ch.free_veh_cache_slots.back();
+        ch.free_veh_cache_slots.pop_back();
+    } else if( ch.veh_cache_slots.size() <= UINT16_MAX ) {
+        id = static_cast<uint16_t>( ch.veh_cache_slots.size() );
+        ch.veh_cache_slots.emplace_back();
+    } else {
+        debugmsg( "Too many vehicles to cache on one z-level" );
+        return 0;
+    }
+    ch.veh_cache_slots[id].veh = veh;
+    ch.veh_cache_slot_of.emplace( veh, id );
+    return id;
+}
+
+void release_veh_cache_slot( level_cache &ch, const uint16_t id )
+{
+    level_cache::veh_cache_slot &slot = ch.veh_cache_slots[id];
+    for( const point &p : slot.tiles ) {
+        level_cache::cached_vpart &cell = ch.veh_cached_parts[p.x][p.y];
+        if( cell.veh == id ) {
+            cell = level_cache::cached_vpart();
+        }
+    }
+    ch.veh_cache_slot_of.erase( slot.veh );
+    slot.veh = nullptr;
+    slot.tiles.clear();
+    ch.free_veh_cache_slots.push_back( id );
+}
+
+} // namespace
+
 void map::add_vehicle_to_cache( vehicle *veh )
 {
     if( veh == nullptr ) {
@@ -241,6 +286,20 @@ void map::add_vehicle_to_cache( vehicle *veh )
 
     auto &ch = get_cache( veh->sm_pos.z );
     ch.veh_in_active_range = true;
+    const uint16_t id = acquire_veh_cache_slot( ch, veh );
+    if( id == 0 ) {
+        return;
+    }
+    std::vector<point> &tiles = ch.veh_cache_slots[id].tiles;
+    // Tiles still listed from an earlier add are either claimed again below or released afterwards
+    std::vector<point> old_tiles;
+    old_tiles.swap( tiles );
+    for( const point &p : old_tiles ) {
+        level_cache::cached_vpart &cell = ch.veh_cached_parts[p.x][p.y];
+        if( cell.veh == id ) {
+            cell.part = stale_vpart;
+        }
+    }
     // Get parts
     std::vector<vehicle_part> &parts = veh->parts;
     int partid = 0;
@@ -250,10 +309,27 @@ void map::add_vehicle_to_cache( vehicle *veh )
             continue;
         }
         const tripoint p = veh->global_part_pos3( *it );
-        ch.veh_cached_parts.insert( std::make_pair( p,
-                                    std::make_pair( veh, partid ) ) );
-        if( inbounds( p ) ) {
-            ch.veh_exists_at[p.x][p.y] = true;
+        if( !inbounds( p ) ) {
+            continue;
+        }
+        level_cache::cached_vpart &cell = ch.veh_cached_parts[p.x][p.y];
+        // First part on a tile wins, as does whichever vehicle got there first
+        if( cell.veh == 0 || ( cell.veh == id && cell.part == stale_vpart ) ) {
+            if( partid >= stale_vpart ) {
+                debugmsg( "Too many parts to cache on vehicle %s", veh->name );
+                break;
+            }
+            cell.veh = id;
+            cell.part = static_cast<uint16_t>( partid );
+            tiles.push_back( p.xy() );
+        }
+    }
+    for( const point &p : old_tiles ) {
+        level_cache::cached_vpart &cell = ch.veh_cached_parts[p.x][p.y];
+        if( cell.veh == id && cell.part == stale_vpart ) {
+            cell = level_cache::cached_vpart();
+            // If something was resting on vehicle, drop it
+            support_dirty( tripoint( p, veh->sm_pos.z + 1 ) );
         }
     }
 
@@ -267,38 +343,34 @@ void map::update_vehicle_cache( vehicle *veh, const int old_zlevel )
         return;
     }
 
-    // Existing must be cleared
-    auto &ch = get_cache( old_zlevel );
-    auto it = ch.veh_cached_parts.begin();
-    const auto end = ch.veh_cached_parts.end();
-    while( it != end ) {
-        if( it->second.first == veh ) {
-            const tripoint p = it->first;
-            if( inbounds( p ) ) {
-                ch.veh_exists_at[p.x][p.y] = false;
+    if( old_zlevel != veh->sm_pos.z ) {
+        // Existing must be cleared
+        auto &ch = get_cache( old_zlevel );
+        const auto found = ch.veh_cache_slot_of.find( veh );
+        if( found != ch.veh_cache_slot_of.end() ) {
+            for( const point &p : ch.veh_cache_slots[found->second].tiles ) {
+                support_dirty( tripoint( p, old_zlevel + 1 ) );
             }
-            ch.veh_cached_parts.erase( it++ );
-            // If something was resting on vehicle, drop it
-            support_dirty( tripoint( p.xy(), old_zlevel + 1 ) );
-        } else {
-            ++it;
+            release_veh_cache_slot( ch, found->second );
         }
     }
 
+    // On the same z-level only the tiles the vehicle left are released
     add_vehicle_to_cache( veh );
 }
 
 void map::clear_vehicle_cache( const int zlev )
 {
     auto &ch = get_cache( zlev );
-    while( !ch.veh_cached_parts.empty() ) {
-        const auto part = ch.veh_cached_parts.begin();
-        const auto &p = part->first;
-        if( inbounds( p ) ) {
-            ch.veh_exists_at[p.x][p.y] = false;
+    for( level_cache::veh_cache_slot &slot : ch.veh_cache_slots ) {
+        for( const point &p : slot.tiles ) {
+            ch.veh_cached_parts[p.x][p.y] = level_cache::cached_vpart();
         }
-        ch.veh_cached_parts.erase( part );
     }
+    ch.veh_cache_slots.resize( 1 );
+    ch.veh_cache_slots.front() = level_cache::veh_cache_slot();
+    ch.free_veh_cache_slots.clear();
+    ch.veh_cache_slot_of.clear();
 }
 
 void map::clear_vehicle_list( const int zlev )
@@ -967,20 +1039,18 @@ const vehicle *map::veh_at_internal( const tripoint &p, int &part_num ) const
 {
     // This function is called A LOT. Move as much out of here as possible.
     const auto &ch = get_cache_ref( p.z );
-    if( !ch.veh_in_active_range || !ch.veh_exists_at[p.x][p.y] ) {
+    if( !ch.veh_in_active_range ) {
         part_num = -1;
-        return nullptr; // Clear cache indicates no vehicle. This should optimize a great deal.
+        return nullptr;
     }
-
-    const auto it = ch.veh_cached_parts.find( p );
-    if( it != ch.veh_cached_parts.end() ) {
-        part_num = it->second.second;
-        return it->second.first;
+    const level_cache::cached_vpart &cell = ch.veh_cached_parts[p.x][p.y];
+    if( cell.veh == 0 ) {
+        part_num = -1;
+        return nullptr; // Clear cache indicates no vehicle. This should optimize a great deal.
     }
 
-    debugmsg( "vehicle part cache indicated vehicle not found: %d %d %d", p.x, p.y, p.z );
-    part_num = -1;
-    return nullptr;
+    part_num = cell.part;
+    return ch.veh_cache_slots[cell.veh].veh;
 }
 
 vehicle *map::veh_at_internal( const tripoint &p, int &part_num )
@@ -1311,6 +1381,7 @@ void map::furn_set( const tripoint &p, const furn_id &new_furniture )
     }
 
     current_submap->set_furn( l, new_furniture );
+    current_submap->mark_changed();
 
     // Set the dirty flags
     const furn_t &old_t = old_id.obj();
@@ -1578,6 +1649,7 @@ bool map::ter_set( const tripoint &p, const ter_id &new_terrain )
     }
 
     current_submap->set_ter( l, new_terrain );
+    current_submap->mark_changed();
 
     // Set the dirty flags
     const ter_t &old_t = old_id.obj();
@@ -1743,6 +1815,21 @@ int map::move_cost_ter_furn( const tripoint &p ) const
     return cost > 0 ? cost : 0;
 }
 
+bool map::has_vehicle_obstacles( const tripoint &min, const tripoint &max ) const
+{
+    if( !inbounds( min ) || !inbounds( tripoint( max.xy(), min.z ) ) ) {
+        return true;
+    }
+    for( int sx = min.x / SEEX; sx <= max.x / SEEX; sx++ ) {
+        for( int sy = min.y / SEEY; sy <= max.y / SEEY; sy++ ) {
+            if( get_submap_at( tripoint( sx * SEEX, sy * SEEY, min.z ) )->has_vehicle_obstacles() ) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
 bool map::impassable_ter_furn( const tripoint &p ) const
 {
     return !passable_ter_furn( p );
@@ -2934,6 +3021,7 @@ void map::smash_items( const tripoint &p, const int power, const std::string &ca
 
         // If an item was damaged, increment the counter and set it as most recently damaged.
         if( item_was_damaged ) {
+            mark_changed( p );
 
             // If this is the first item to be damaged, store its name in damaged_item_name.
             if( items_damaged == 0 ) {
@@ -4024,6 +4112,7 @@ map_stack::iterator map::i_rem( const tripoint &p, map_stack::const_iterator it
     }
 
     current_submap->update_lum_rem( l, *it );
+    current_submap->mark_changed();
 
     return current_submap->get_items( l ).erase( it );
 }
@@ -4037,6 +4126,27 @@ void map::i_rem( const tripoint &p, item *it )
     }
 }
 
+void map::mark_changed( const tripoint &p )
+{
+    if( inbounds( p ) ) {
+        get_submap_at( p )->mark_changed();
+    }
+}
+
+uint64_t map::last_change_near( const tripoint &origin, const int radius ) const
+{
+    const point lo( std::max( origin.x - radius, 0 ), std::max( origin.y - radius, 0 ) );
+    const point hi( std::min( origin.x + radius, MAPSIZE_X - 1 ),
+                    std::min( origin.y + radius, MAPSIZE_Y - 1 ) );
+    uint64_t last = 0;
+    for( int sx = lo.x / SEEX; sx <= hi.x / SEEX; sx++ ) {
+        for( int sy = lo.y / SEEY; sy <= hi.y / SEEY; sy++ ) {
+            last = std::max( last, get_submap_at( tripoint( sx * SEEX, sy * SEEY, origin.z ) )->last_change );
+        }
+    }
+    return last;
+}
+
 void map::i_clear( const tripoint &p )
 {
     point l;
@@ -4052,6 +4162,7 @@ void map::i_clear( const tripoint &p )
 
     current_submap->set_lum( l, 0 );
     current_submap->get_items( l ).clear();
+    current_submap->mark_changed();
 }
 
 item &map::spawn_an_item( const tripoint &p, item new_item,
@@ -4179,6 +4290,7 @@ item &map::add_item_or_charges( const tripoint &pos, item obj, bool overflow )
         {
             for( auto &e : i_at( tile ) ) {
                 if( e.merge_charges( obj ) ) {
+                    mark_changed( tile );
                     return e;
                 }
             }
@@ -4285,6 +4397,7 @@ item &map::add_item( const tripoint &p, item new_item )
     current_submap->update_lum_add( l, new_item );
 
     const map_stack::iterator new_pos = current_submap->get_items( l ).insert( new_item );
+    current_submap->mark_changed();
     if( new_item.needs_processing() ) {
         if( current_submap->active_items.empty() ) {
             submaps_with_active_items.insert( tripoint( abs_sub.x + p.x / SEEX, abs_sub.y + p.y / SEEY, p.z ) );
@@ -4390,6 +4503,111 @@ static bool process_map_items( item_stack &items, safe_reference<item> &item_ref
     return false;
 }
 
+namespace
+{
+/**
+ * Active items whose processing consists only of rotting (see @ref item::has_rot_only_processing),
+ * set aside from the regular per-item processing so they can be handled in bulk.
+ * Locations and items are kept in parallel arrays and visited grouped by location,
+ * so the temperature, terrain and item stack of a tile are looked up once per tile
+ * instead of once per item. Food stockpiles and freezers are the common case here.
+ */
+class rot_batch
+{
+    private:
+        std::vector<point> locations;
+        std::vector<safe_reference<item>> items;
+
+    public:
+        void add( const item_reference &ref ) {
+            locations.push_back( ref.location );
+            items.push_back( ref.item_ref );
+        }
+
+        bool empty() const {
+            return items.empty();
+        }
+
+        /**
+         * Calls @p func once for every distinct location, with the location and
+         * the references of all items collected at it.
+         */
+        template<typename Func>
+        void for_each_location( Func func ) {
+            std::vector<size_t> order( items.size() );
+            for( size_t i = 0; i < order.size(); ++i ) {
+                order[i] = i;
+            }
+            std::sort( order.begin(), order.end(), [this]( size_t lhs, size_t rhs ) {
+                return locations[lhs] < locations[rhs];
+            } );
+            std::vector<safe_reference<item> *> run;
+            for( size_t i = 0; i < order.size(); ) {
+                const point &loc = locations[order[i]];
+                run.clear();
+                for( ; i < order.size() && locations[order[i]] == loc; ++i ) {
+                    run.push_back( &items[order[i]] );
+                }
+                func( loc, run );
+            }
+        }
+};
+} // namespace
+
+/**
+ * Rot kernel: processes food items that share one tile and therefore one temperature.
+ * Items rotting away are removed from @p items.
+ */
+static void process_rot_items( map &m, item_stack &items,
+                               const std::vector<safe_reference<item> *> &run,
+                               const tripoint &location, const temperature_flag flag )
+{
+    cata::optional<int> temp;
+    for( safe_reference<item> *item_ref : run ) {
+        if( !*item_ref || !( *item_ref )->is_rot_update_due() ) {
+            // Destroyed by the processing of some other item, or nothing to do yet.
+            continue;
+        }
+        item &it = **item_ref;
+        if( !temp ) {
+            temp = g->weather.get_temperature( location );
+        }
+        const bool was_rotten = it.rotten();
+        if( it.process_rot_with_temperature( *temp, location, flag ) ) {
+            if( it.is_comestible() ) {
+                m.rotten_item_spawn( it, location );
+            }
+            if( *item_ref ) {
+                items.erase( items.get_iterator_from_pointer( &it ) );
+            }
+        } else if( !was_rotten && it.rotten() ) {
+            // Rotten items no longer count as crafting components.
+            m.mark_changed( location );
+        }
+    }
+}
+
+static temperature_flag cargo_temperature_flag( const vehicle_part &pt, bool engine_heater_is_on,
+        float &insulation )
+{
+    const vpart_info &pti = pt.info();
+    temperature_flag flag = temperature_flag::TEMP_NORMAL;
+    if( engine_heater_is_on ) {
+        flag = temperature_flag::TEMP_HEATER;
+    }
+    // some vehicle parts provide insulation, default is 1
+    insulation = item::find_type( pti.item )->insulation_factor;
+
+    if( pt.enabled && pti.has_flag( VPFLAG_FRIDGE ) ) {
+        insulation = 1; // ignore fridge insulation if on
+        flag = temperature_flag::TEMP_FRIDGE;
+    } else if( pt.enabled && pti.has_flag( VPFLAG_FREEZER ) ) {
+        insulation = 1; // ignore freezer insulation if on
+        flag = temperature_flag::TEMP_FREEZER;
+    }
+    return flag;
+}
+
 static void process_vehicle_items( vehicle &cur_veh, int part )
 {
     const bool washmachine_here = cur_veh.part_flag( part, VPFLAG_WASHING_MACHINE ) &&
@@ -4549,11 +4767,16 @@ void map::process_items_in_submap( submap &current_submap, const tripoint &gridp
     // If they are destroyed before processing, they don't get processed.
     std::vector<item_reference> active_items = current_submap.active_items.get_for_processing();
     const point grid_offset( gridp.x * SEEX, gridp.y * SEEY );
+    rot_batch rotting;
     for( item_reference &active_item_ref : active_items ) {
         if( !active_item_ref.item_ref ) {
             // The item was destroyed, so skip it.
             continue;
         }
+        if( active_item_ref.item_ref->has_rot_only_processing() ) {
+            rotting.add( active_item_ref );
+            continue;
+        }
 
         const tripoint map_location = tripoint( grid_offset + active_item_ref.location, gridp.z );
         // root cellars are special
@@ -4564,6 +4787,16 @@ void map::process_items_in_submap( submap &current_submap, const tripoint &gridp
         map_stack items = i_at( map_location );
         process_map_items( items, active_item_ref.item_ref, map_location, 1, flag );
     }
+    rotting.for_each_location( [&]( const point & location,
+    const std::vector<safe_reference<item> *> &run ) {
+        const tripoint map_location = tripoint( grid_offset + location, gridp.z );
+        temperature_flag flag = temperature_flag::TEMP_NORMAL;
+        if( ter( map_location ) == t_rootcellar ) {
+            flag = temperature_flag::TEMP_ROOT_CELLAR;
+        }
+        map_stack items = i_at( map_location );
+        process_rot_items( *this, items, run, map_location, flag );
+    } );
 }
 
 void map::process_items_in_vehicles( submap &current_submap )
@@ -4599,6 +4832,7 @@ void map::process_items_in_vehicle( vehicle &cur_veh, submap &current_submap )
         process_vehicle_items( cur_veh, vp.part_index() );
     }
 
+    rot_batch rotting;
     for( item_reference &active_item_ref : cur_veh.active_items.get_for_processing() ) {
         if( empty( cargo_parts ) ) {
             return;
@@ -4606,6 +4840,10 @@ void map::process_items_in_vehicle( vehicle &cur_veh, submap &current_submap )
             // The item was destroyed, so skip it.
             continue;
         }
+        if( active_item_ref.item_ref->has_rot_only_processing() ) {
+            rotting.add( active_item_ref );
+            continue;
+        }
         const auto it = std::find_if( begin( cargo_parts ),
         end( cargo_parts ), [&]( const vpart_reference & part ) {
             return active_item_ref.location == part.mount();
@@ -4622,20 +4860,7 @@ void map::process_items_in_vehicle( vehicle &cur_veh, submap &current_submap )
         float it_insulation = 1.0;
         temperature_flag flag = temperature_flag::TEMP_NORMAL;
         if( target.is_food() || target.is_food_container() || target.is_corpse() ) {
-            const vpart_info &pti = pt.info();
-            if( engine_heater_is_on ) {
-                flag = temperature_flag::TEMP_HEATER;
-            }
-            // some vehicle parts provide insulation, default is 1
-            it_insulation = item::find_type( pti.item )->insulation_factor;
-
-            if( pt.enabled && pti.has_flag( VPFLAG_FRIDGE ) ) {
-                it_insulation = 1; // ignore fridge insulation if on
-                flag = temperature_flag::TEMP_FRIDGE;
-            } else if( pt.enabled && pti.has_flag( VPFLAG_FREEZER ) ) {
-                it_insulation = 1; // ignore freezer insulation if on
-                flag = temperature_flag::TEMP_FREEZER;
-            }
+            flag = cargo_temperature_flag( pt, engine_heater_is_on, it_insulation );
         }
         if( !process_map_items( items, active_item_ref.item_ref, item_loc, it_insulation, flag ) ) {
             // If the item was NOT destroyed, we can skip the remainder,
@@ -4658,6 +4883,21 @@ void map::process_items_in_vehicle( vehicle &cur_veh, submap &current_submap )
         // parts would move up to fill the gap).
         cargo_parts = cur_veh.get_any_parts( VPFLAG_CARGO );
     }
+    rotting.for_each_location( [&]( const point & mount,
+    const std::vector<safe_reference<item> *> &run ) {
+        const auto it = std::find_if( begin( cargo_parts ),
+        end( cargo_parts ), [&]( const vpart_reference & part ) {
+            return mount == part.mount();
+        } );
+        if( it == end( cargo_parts ) ) {
+            return;
+        }
+        float it_insulation = 1.0;
+        const temperature_flag flag = cargo_temperature_flag( it->part(), engine_heater_is_on,
+                                      it_insulation );
+        auto items = cur_veh.get_items( static_cast<int>( it->part_index() ) );
+        process_rot_items( *this, items, run, it->pos(), flag );
+    } );
 }
 
 // Crafting/item finding functions
@@ -4737,6 +4977,8 @@ std::list<item> map::use_amount_square( const tripoint &p, const itype_id &type,
         quantity = 0;
         return ret;
     }
+    // Stacks may only lose some of their charges.
+    mark_changed( p );
 
     if( const cata::optional<vpart_reference> vp = veh_at( p ).part_with_feature( "CARGO", true ) ) {
         std::list<item> tmp = use_amount_stack( vp->vehicle().get_items( vp->part_index() ), type,
@@ -4781,6 +5023,7 @@ std::list<item> use_charges_from_stack( Stack stack, const itype_id &type, int &
 static void use_charges_from_furn( const furn_t &f, const itype_id &type, int &quantity,
                                    map *m, const tripoint &p, std::list<item> &ret, const std::function<bool( const item & )> &filter )
 {
+    m->mark_changed( p );
     if( m->has_flag( "LIQUIDCONT", p ) ) {
         auto item_list = m->i_at( p );
         auto current_item = item_list.begin();
@@ -4881,6 +5124,7 @@ std::list<item> map::use_charges( const tripoint &origin, const int range,
         }
 
         if( accessible_items( p ) ) {
+            mark_changed( p );
             std::list<item> tmp = use_charges_from_stack( i_at( p ), type, quantity, p, filter );
             ret.splice( ret.end(), tmp );
             if( quantity <= 0 ) {
@@ -5356,6 +5600,7 @@ bool map::add_field( const tripoint &p, const field_type_id &type_id, int intens
     invalidate_max_populated_zlev( p.z );
 
     if( current_submap->get_field( l ).add_field( type_id, intensity, age ) ) {
+        current_submap->mark_changed();
         //Only adding it to the count if it doesn't exist.
         if( !current_submap->field_count++ ) {
             get_cache( p.z ).field_cache.set( static_cast<size_t>( p.x / SEEX + ( (
@@ -5399,6 +5644,7 @@ void map::remove_field( const tripoint &p, const field_type_id &field_to_remove
     submap *const current_submap = get_submap_at( p, l );
 
     if( current_submap->get_field( l ).remove_field( field_to_remove ) ) {
+        current_submap->mark_changed();
         // Only adjust the count if the field actually existed.
         if( !--current_submap->field_count ) {
             get_cache( p.z ).field_cache.set( static_cast<size_t>( p.x / SEEX + ( (
@@ -7081,6 +7327,7 @@ void map::produce_sap( const tripoint &p, const time_duration &time_since_last_a
                 sap.charges = new_charges;
 
                 it.fill_with( sap );
+                mark_changed( p );
             }
             // Only fill up the first container.
             break;
@@ -8285,19 +8532,17 @@ std::list<item_location> map::get_active_items_in_radius( const tripoint &center
         const point sm_offset( submap_loc.x * SEEX, submap_loc.y * SEEY );
 
         submap *sm = get_submap_at_grid( submap_loc );
-        std::vector<item_reference> items = type == special_item_type::none ? sm->active_items.get() :
-                                            sm->active_items.get_special( type );
-        for( const auto &elem : items ) {
+        sm->active_items.for_each( type, [&]( const item_reference & elem ) {
             const tripoint pos( sm_offset + elem.location, submap_loc.z );
 
             if( rl_dist( pos, center ) > radius ) {
-                continue;
+                return;
             }
 
             if( elem.item_ref ) {
                 result.emplace_back( map_cursor( pos ), elem.item_ref.get() );
             }
-        }
+        } );
     }
 
     return result;
@@ -8368,7 +8613,7 @@ level_cache::level_cache()
     std::fill_n( &camera_cache[0][0], map_dimensions, 0.0f );
     std::fill_n( &visibility_cache[0][0], map_dimensions, LL_DARK );
     veh_in_active_range = false;
-    std::fill_n( &veh_exists_at[0][0], map_dimensions, false );
+    veh_cache_slots.resize( 1 );
 }
 
 pathfinding_cache::pathfinding_cache()
@@ -14,6 +14,7 @@
 #include <set>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -312,9 +313,23 @@ struct level_cache {
     std::bitset<MAPSIZE_X *MAPSIZE_Y> map_memory_seen_cache;
     std::bitset<MAPSIZE *MAPSIZE> field_cache;
 
+    // Vehicle part covering a tile, `veh` indexes veh_cache_slots.
+    // Slot 0 is never handed out, so a zeroed entry means there's no vehicle.
+    struct cached_vpart {
+        uint16_t veh = 0;
+        uint16_t part = 0;
+    };
+    struct veh_cache_slot {
+        vehicle *veh = nullptr;
+        // Tiles of veh_cached_parts currently held by this vehicle
+        std::vector<point> tiles;
+    };
+
     bool veh_in_active_range;
-    bool veh_exists_at[MAPSIZE_X][MAPSIZE_Y];
-    std::map< tripoint, std::pair<vehicle *, int> > veh_cached_parts;
+    cached_vpart veh_cached_parts[MAPSIZE_X][MAPSIZE_Y];
+    std::vector<veh_cache_slot> veh_cache_slots;
+    std::vector<uint16_t> free_veh_cache_slots;
+    std::unordered_map<const vehicle *, uint16_t> veh_cache_slot_of;
     std::set<vehicle *> vehicle_list;
     std::set<vehicle *> zone_vehicles;
 
@@ -591,6 +606,13 @@ class map
         }
         bool impassable_ter_furn( const tripoint &p ) const;
         bool passable_ter_furn( const tripoint &p ) const;
+        /**
+         * Whether the box from @p min to @p max (on the z-level of @p min) may contain terrain or
+         * furniture a vehicle can collide with, i.e. with a move cost other than 2.
+         * Answered per submap, so it's only a cheap first check. Parts of the box outside
+         * of the reality bubble always count as obstacles.
+         */
+        bool has_vehicle_obstacles( const tripoint &min, const tripoint &max ) const;
 
         /**
         * Cost to move out of one tile and into the next.
@@ -1168,6 +1190,17 @@ class map
         void i_rem( const point &p, item *it ) {
             i_rem( tripoint( p, abs_sub.z ), it );
         }
+        /**
+         * Stamps the submap containing @p p as changed, see @ref last_change_near.
+         * Adding or removing items, terrain, furniture and fields does this already,
+         * it's only needed when items on the map are modified in place.
+         */
+        void mark_changed( const tripoint &p );
+        /**
+         * Most recent change stamp of the submaps within @p radius of @p origin (on its z-level).
+         * Lets caches of the map contents around a point tell whether they are still current.
+         */
+        uint64_t last_change_near( const tripoint &origin, int radius ) const;
         void spawn_artifact( const tripoint &p );
         void spawn_natural_artifact( const tripoint &p, artifact_natural_property prop );
         void spawn_item( const tripoint &p, const std::string &type_id,
@@ -8,6 +8,7 @@
 #include <utility>
 #include <vector>
 
+#include "avatar.h"
 #include "cata_utility.h"
 #include "coordinate_conversions.h"
 #include "debug.h"
@@ -16,14 +17,17 @@
 #include "fstream_utils.h"
 #include "game.h"
 #include "game_constants.h"
+#include "item.h"
 #include "json.h"
 #include "map.h"
+#include "npc.h"
 #include "output.h"
 #include "popup.h"
 #include "string_formatter.h"
 #include "submap.h"
 #include "translations.h"
 #include "ui_manager.h"
+#include "vehicle.h"
 
 static std::string find_quad_path( const std::string &dirname, const tripoint &om_addr )
 {
@@ -52,6 +56,8 @@ void mapbuffer::reset()
         delete elem.second;
     }
     submaps.clear();
+    quad_last_use.clear();
+    evicted_quads.clear();
 }
 
 bool mapbuffer::add_submap( const tripoint &p, submap *sm )
@@ -61,6 +67,9 @@ bool mapbuffer::add_submap( const tripoint &p, submap *sm )
     }
 
     submaps[p] = sm;
+    const tripoint om_addr = sm_to_omt_copy( p );
+    touch_quad( om_addr );
+    evicted_quads.erase( om_addr );
 
     return true;
 }
@@ -83,6 +92,7 @@ void mapbuffer::remove_submap( tripoint addr )
     }
     delete m_target->second;
     submaps.erase( m_target );
+    quad_last_use.erase( sm_to_omt_copy( addr ) );
 }
 
 submap *mapbuffer::lookup_submap( const tripoint &p )
@@ -97,9 +107,152 @@ submap *mapbuffer::lookup_submap( const tripoint &p )
         return nullptr;
     }
 
+    touch_quad( sm_to_omt_copy( p ) );
     return iter->second;
 }
 
+void mapbuffer::touch_quad( const tripoint &om_addr )
+{
+    quad_last_use[om_addr] = ++use_clock;
+}
+
+/** Approximate memory used by @p sm, in bytes. */
+static size_t submap_bytes( const submap &sm )
+{
+    size_t items = 0;
+    for( int x = 0; x < SEEX; x++ ) {
+        for( int y = 0; y < SEEY; y++ ) {
+            items += sm.get_items( point( x, y ) ).size();
+        }
+    }
+    return sizeof( submap ) + items * sizeof( item ) + sm.vehicles.size() * sizeof( vehicle );
+}
+
+size_t mapbuffer::resident_count() const
+{
+    return submaps.size();
+}
+
+size_t mapbuffer::resident_bytes() const
+{
+    size_t bytes = 0;
+    for( const auto &elem : submaps ) {
+        if( elem.second != nullptr ) {
+            bytes += submap_bytes( *elem.second );
+        }
+    }
+    return bytes;
+}
+
+size_t mapbuffer::evicted_count() const
+{
+    // Quads are unloaded whole
+    return evicted_quads.size() * 4;
+}
+
+size_t mapbuffer::evicted_bytes() const
+{
+    size_t bytes = 0;
+    for( const auto &elem : evicted_quads ) {
+        bytes += elem.second;
+    }
+    return bytes;
+}
+
+std::set<point> mapbuffer::quads_in_use() const
+{
+    // Camp expansions are on the overmap tiles next to the camp
+    static constexpr int camp_radius = 1;
+
+    std::set<point> in_use;
+    const auto keep_around = [&]( const point & omt, int radius ) {
+        for( int x = -radius; x <= radius; x++ ) {
+            for( int y = -radius; y <= radius; y++ ) {
+                in_use.insert( omt + point( x, y ) );
+            }
+        }
+    };
+    // Same area as the one kept by save()
+    const point map_origin = sm_to_omt_copy( g->m.get_abs_sub() ).xy();
+    for( int x = 0; x <= HALF_MAPSIZE; x++ ) {
+        for( int y = 0; y <= HALF_MAPSIZE; y++ ) {
+            in_use.insert( map_origin + point( x, y ) );
+        }
+    }
+    for( const npc &guy : g->all_npcs() ) {
+        keep_around( guy.global_omt_location().xy(), 1 );
+    }
+    for( const tripoint &camp : g->u.camps ) {
+        keep_around( camp.xy(), camp_radius );
+    }
+    for( const tripoint &sm_pos : get_distribution_grid_tracker().tracked_submaps() ) {
+        in_use.insert( sm_to_omt_copy( sm_pos ).xy() );
+    }
+    return in_use;
+}
+
+size_t mapbuffer::unload_cold( size_t budget )
+{
+    size_t used = resident_bytes();
+    if( used <= budget ) {
+        return 0;
+    }
+
+    const std::set<point> in_use = quads_in_use();
+    std::set<tripoint> cold_quads;
+    for( const auto &elem : submaps ) {
+        const tripoint om_addr = sm_to_omt_copy( elem.first );
+        if( in_use.count( om_addr.xy() ) == 0 ) {
+            cold_quads.insert( om_addr );
+        }
+    }
+    // Least recently used first
+    std::vector<std::pair<uint64_t, tripoint>> by_use;
+    for( const tripoint &om_addr : cold_quads ) {
+        const auto iter = quad_last_use.find( om_addr );
+        by_use.emplace_back( iter == quad_last_use.end() ? 0 : iter->second, om_addr );
+    }
+    std::sort( by_use.begin(), by_use.end() );
+    if( !by_use.empty() ) {
+        assure_dir_exist( g->get_world_base_save_path() + "/maps" );
+    }
+
+    size_t num_unloaded = 0;
+    for( const std::pair<uint64_t, tripoint> &quad : by_use ) {
+        if( used <= budget ) {
+            break;
+        }
+        const tripoint &om_addr = quad.second;
+        const tripoint sm_addr = omt_to_sm_copy( om_addr );
+        size_t quad_bytes = 0;
+        for( const point &offset : { point_zero, point_south, point_east, point_south_east } ) {
+            const auto iter = submaps.find( sm_addr + offset );
+            if( iter != submaps.end() && iter->second != nullptr ) {
+                quad_bytes += submap_bytes( *iter->second );
+            }
+        }
+
+        const std::string dirname = find_dirname( om_addr );
+        std::list<tripoint> submaps_to_delete;
+        save_quad( dirname, find_quad_path( dirname, om_addr ), om_addr, submaps_to_delete, true );
+        for( const tripoint &addr : submaps_to_delete ) {
+            remove_submap( addr );
+        }
+        // save_quad leaves empty entries for missing members of the quad
+        for( const point &offset : { point_zero, point_south, point_east, point_south_east } ) {
+            const auto iter = submaps.find( sm_addr + offset );
+            if( iter != submaps.end() && iter->second == nullptr ) {
+                submaps.erase( iter );
+            }
+        }
+        quad_last_use.erase( om_addr );
+        evicted_quads[om_addr] = quad_bytes;
+        used -= std::min( used, quad_bytes );
+        num_unloaded += submaps_to_delete.size();
+    }
+    return num_unloaded;
+}
+
 void mapbuffer::save( bool delete_after_save )
 {
     assure_dir_exist( g->get_world_base_save_path() + "/maps" );
@@ -2,10 +2,14 @@
 #ifndef CATA_SRC_MAPBUFFER_H
 #define CATA_SRC_MAPBUFFER_H
 
+#include <cstddef>
+#include <cstdint>
 #include <list>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
+#include <unordered_map>
 
 #include "point.h"
 
@@ -54,6 +58,25 @@ class mapbuffer
          */
         submap *lookup_submap( const tripoint &p );
 
+        /**
+         * Saves and unloads the least recently used submap quads until the buffered
+         * submaps use at most @p budget bytes (see @ref resident_bytes).
+         * Quads in the reality bubble, near active NPCs, near the camps of the player
+         * and those belonging to a tracked distribution grid are never unloaded.
+         * Unloaded submaps are loaded again by @ref lookup_submap when needed.
+         * @return The number of unloaded submaps.
+         */
+        size_t unload_cold( size_t budget );
+
+        /** Number of buffered submaps. */
+        size_t resident_count() const;
+        /** Approximate memory used by the buffered submaps, in bytes. */
+        size_t resident_bytes() const;
+        /** Number of submaps unloaded by @ref unload_cold and not loaded since. */
+        size_t evicted_count() const;
+        /** Approximate memory the submaps counted by @ref evicted_count used, in bytes. */
+        size_t evicted_bytes() const;
+
     private:
         using submap_map_t = std::map<tripoint, submap *>;
 
@@ -70,11 +93,20 @@ class mapbuffer
         // if not handled carefully, this can erase in-use submaps and crash the game.
         void remove_submap( tripoint addr );
         submap *unserialize_submaps( const tripoint &p );
+        /** Marks the quad (in overmap terrain coordinates) as just used. */
+        void touch_quad( const tripoint &om_addr );
+        /** Overmap terrain columns (all z-levels) that must stay loaded. */
+        std::set<point> quads_in_use() const;
         void deserialize( JsonIn &jsin );
         void save_quad( const std::string &dirname, const std::string &filename,
                         const tripoint &om_addr, std::list<tripoint> &submaps_to_delete,
                         bool delete_after_save );
         submap_map_t submaps;
+        /** Last use of each quad, by overmap terrain coordinates, larger is more recent. */
+        std::unordered_map<tripoint, uint64_t> quad_last_use;
+        uint64_t use_clock = 0;
+        /** Approximate size of the quads unloaded by @ref unload_cold, by overmap terrain coordinates. */
+        std::unordered_map<tripoint, size_t> evicted_quads;
 };
 
 extern mapbuffer MAPBUFFER;
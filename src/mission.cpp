@@ -592,6 +592,11 @@ character_id mission::get_npc_id() const
     return npc_id;
 }
 
+character_id mission::get_target_npc_id() const
+{
+    return target_npc_id;
+}
+
 const std::vector<std::pair<int, std::string>> &mission::get_likely_rewards() const
 {
     return type->likely_rewards;
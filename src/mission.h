@@ -364,6 +364,7 @@ class mission
         int get_id() const;
         const std::string &get_item_id() const;
         character_id get_npc_id() const;
+        character_id get_target_npc_id() const;
         const std::vector<std::pair<int, std::string>> &get_likely_rewards() const;
         bool has_generic_rewards() const;
         /**
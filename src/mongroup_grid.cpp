@@ -0,0 +1,91 @@
+#include "mongroup_grid.h"
+
+mongroup_grid::mongroup_grid() : buckets( buckets_x * buckets_y )
+{
+}
+
+mongroup_grid::mongroup_grid( const mongroup_grid &other ) : mongroup_grid()
+{
+    *this = other;
+}
+
+mongroup_grid &mongroup_grid::operator=( const mongroup_grid &other )
+{
+    if( this == &other ) {
+        return *this;
+    }
+    clear();
+    other.for_each( [this]( const mongroup & group ) {
+        insert( group );
+    } );
+    return *this;
+}
+
+mongroup_grid::handle mongroup_grid::insert( const mongroup &group )
+{
+    const handle h = groups.insert( std::make_unique<mongroup>( group ) );
+    bucket_for( group.pos.xy() ).push_back( h );
+    return h;
+}
+
+bool mongroup_grid::erase( const handle &h )
+{
+    const std::unique_ptr<mongroup> *group = groups.get( h );
+    if( group == nullptr ) {
+        return false;
+    }
+    remove_from( bucket_for( ( *group )->pos.xy() ), h );
+    return groups.erase( h );
+}
+
+mongroup *mongroup_grid::get( const handle &h )
+{
+    std::unique_ptr<mongroup> *group = groups.get( h );
+    return group ? group->get() : nullptr;
+}
+
+void mongroup_grid::move( const handle &h, const tripoint &pos )
+{
+    mongroup *group = get( h );
+    if( group == nullptr ) {
+        return;
+    }
+    std::vector<handle> &from = bucket_for( group->pos.xy() );
+    std::vector<handle> &to = bucket_for( pos.xy() );
+    if( &from != &to ) {
+        remove_from( from, h );
+        to.push_back( h );
+    }
+    group->pos = pos;
+}
+
+void mongroup_grid::clear()
+{
+    groups.clear();
+    for( std::vector<handle> &bucket : buckets ) {
+        bucket.clear();
+    }
+    outside.clear();
+}
+
+std::vector<mongroup_grid::handle> &mongroup_grid::bucket_for( const point &p )
+{
+    if( p.x < 0 || p.y < 0 || p.x >= OMAPX * 2 || p.y >= OMAPY * 2 ) {
+        return outside;
+    }
+    return buckets[( p.x / bucket_size ) * buckets_y + p.y / bucket_size];
+}
+
+const std::vector<mongroup_grid::handle> &mongroup_grid::bucket_for( const point &p ) const
+{
+    return const_cast<mongroup_grid *>( this )->bucket_for( p );
+}
+
+void mongroup_grid::remove_from( std::vector<handle> &handles, const handle &h )
+{
+    const auto it = std::find( handles.begin(), handles.end(), h );
+    if( it != handles.end() ) {
+        *it = handles.back();
+        handles.pop_back();
+    }
+}
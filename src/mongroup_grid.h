@@ -0,0 +1,144 @@
+#pragma once
+#ifndef CATA_SRC_MONGROUP_GRID_H
+#define CATA_SRC_MONGROUP_GRID_H
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "game_constants.h"
+#include "mongroup.h"
+#include "point.h"
+#include "slot_map.h"
+
+/**
+ * The monster groups of one overmap.
+ *
+ * Groups are kept behind stable handles and bucketed by their submap position
+ * (relative to the overmap), so the groups at a point or inside an area are found
+ * without visiting all of them. Groups outside of the overmap are kept aside and
+ * checked by every query.
+ * A group stays at the same address until it is erased. Its position must only be
+ * changed through @ref move.
+ */
+class mongroup_grid
+{
+    public:
+        using handle = cata::slot_map_handle;
+        /** Width and height of a bucket, in submaps. */
+        static constexpr int bucket_size = 12;
+
+        mongroup_grid();
+        mongroup_grid( const mongroup_grid &other );
+        mongroup_grid( mongroup_grid && ) = default;
+        mongroup_grid &operator=( const mongroup_grid &other );
+        mongroup_grid &operator=( mongroup_grid && ) = default;
+
+        handle insert( const mongroup &group );
+        /** Erases the group, returns false if the handle is stale. */
+        bool erase( const handle &h );
+        /** Returns the group, or nullptr if the handle is stale. */
+        mongroup *get( const handle &h );
+        /** Changes the position of the group, keeping its handle. */
+        void move( const handle &h, const tripoint &pos );
+        void clear();
+
+        size_t size() const {
+            return groups.size();
+        }
+        bool empty() const {
+            return groups.empty();
+        }
+
+        /** Calls @p f( handle, mongroup & ) for every group. @p f may @ref move groups. */
+        template<typename F>
+        void for_each( F f ) {
+            for( size_t i = 0; i < groups.size(); ++i ) {
+                f( groups.handle_at( i ), *groups[i] );
+            }
+        }
+        /** Calls @p f( const mongroup & ) for every group. */
+        template<typename F>
+        void for_each( F f ) const {
+            for( size_t i = 0; i < groups.size(); ++i ) {
+                f( static_cast<const mongroup &>( *groups[i] ) );
+            }
+        }
+
+        /** Calls @p f( mongroup & ) for every group at exactly @p p. */
+        template<typename F>
+        void for_each_at( const tripoint &p, F f ) {
+            for( const handle &h : bucket_for( p.xy() ) ) {
+                mongroup &group = **groups.get( h );
+                if( group.pos == p ) {
+                    f( group );
+                }
+            }
+        }
+        template<typename F>
+        void for_each_at( const tripoint &p, F f ) const {
+            for( const handle &h : bucket_for( p.xy() ) ) {
+                const mongroup &group = **groups.get( h );
+                if( group.pos == p ) {
+                    f( group );
+                }
+            }
+        }
+
+        /** Calls @p f( mongroup & ) for every group inside the box from @p min to @p max, inclusive. */
+        template<typename F>
+        void for_each_in( const tripoint &min, const tripoint &max, F f ) {
+            const auto visit = [&]( const std::vector<handle> &handles ) {
+                for( const handle &h : handles ) {
+                    mongroup &group = **groups.get( h );
+                    const tripoint &p = group.pos;
+                    if( p.x >= min.x && p.x <= max.x && p.y >= min.y && p.y <= max.y &&
+                        p.z >= min.z && p.z <= max.z ) {
+                        f( group );
+                    }
+                }
+            };
+            const int first_x = std::max( min.x, 0 ) / bucket_size;
+            const int first_y = std::max( min.y, 0 ) / bucket_size;
+            const int last_x = std::min( max.x, OMAPX * 2 - 1 ) / bucket_size;
+            const int last_y = std::min( max.y, OMAPY * 2 - 1 ) / bucket_size;
+            if( max.x >= 0 && max.y >= 0 ) {
+                for( int x = first_x; x <= last_x; ++x ) {
+                    for( int y = first_y; y <= last_y; ++y ) {
+                        visit( buckets[x * buckets_y + y] );
+                    }
+                }
+            }
+            visit( outside );
+        }
+
+        /** Erases every group for which @p pred( mongroup & ) returns true. */
+        template<typename Pred>
+        void erase_if( Pred pred ) {
+            for( size_t i = 0; i < groups.size(); ) {
+                if( pred( *groups[i] ) ) {
+                    // The last group takes the place of the erased one
+                    erase( groups.handle_at( i ) );
+                } else {
+                    ++i;
+                }
+            }
+        }
+
+    private:
+        static constexpr int buckets_x = ( OMAPX * 2 + bucket_size - 1 ) / bucket_size;
+        static constexpr int buckets_y = ( OMAPY * 2 + bucket_size - 1 ) / bucket_size;
+
+        std::vector<handle> &bucket_for( const point &p );
+        const std::vector<handle> &bucket_for( const point &p ) const;
+        static void remove_from( std::vector<handle> &handles, const handle &h );
+
+        cata::slot_map<std::unique_ptr<mongroup>> groups;
+        /** Handles of the groups in each bucket, indexed by x * buckets_y + y. */
+        std::vector<std::vector<handle>> buckets;
+        /** Handles of the groups outside of the overmap. */
+        std::vector<handle> outside;
+};
+
+#endif // CATA_SRC_MONGROUP_GRID_H
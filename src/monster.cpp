@@ -2266,11 +2266,10 @@ void monster::die( Creature *nkiller )
         // submap coordinates.
         const tripoint abssub = ms_to_sm_copy( g->m.getabs( pos() ) );
         // Do it for overmap above/below too
-        for( const tripoint &p : points_in_radius( abssub, HALF_MAPSIZE, 1 ) ) {
-            for( auto &mgp : overmap_buffer.groups_at( p ) ) {
-                if( MonsterGroupManager::IsMonsterInGroup( mgp->type, type->id ) ) {
-                    mgp->dying = true;
-                }
+        const tripoint reach( HALF_MAPSIZE, HALF_MAPSIZE, 1 );
+        for( mongroup *mgp : overmap_buffer.groups_in( abssub - reach, abssub + reach ) ) {
+            if( MonsterGroupManager::IsMonsterInGroup( mgp->type, type->id ) ) {
+                mgp->dying = true;
             }
         }
     }
@@ -1357,6 +1357,11 @@ void options_manager::add_options_general()
 
     get_option( "AUTOSAVE_MINUTES" ).setPrerequisite( "AUTOSAVE" );
 
+    add( "MAP_MEMORY_BUDGET", "general", translate_marker( "Map memory budget" ),
+         translate_marker( "Approximate amount of memory, in megabytes, the loaded overmaps and map areas may use.  When it is exceeded, the areas used least recently and far from the player, their NPCs, camps and electric grids are written to the save and unloaded until needed again.  0 means no limit." ),
+         0, 65536, 2048
+       );
+
     add_empty_line();
 
     add( "AUTO_NOTES", "general", translate_marker( "Auto notes" ),
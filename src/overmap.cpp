@@ -3,9 +3,13 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <climits>
 #include <cmath>
 #include <cstring>
 #include <exception>
+#include <functional>
+#include <future>
 #include <memory>
 #include <numeric>
 #include <ostream>
@@ -1159,21 +1163,38 @@ oter_id overmap::get_default_terrain( int z ) const
     }
 }
 
+static uint64_t terrain_change_counter = 0;
+static uint64_t view_change_counter = 0;
+
 void overmap::init_layers()
 {
+    ++terrain_change_counter;
+    ++view_change_counter;
+    terrain_index_built = false;
+    terrain_index.clear();
     for( int k = 0; k < OVERMAP_LAYERS; ++k ) {
         const oter_id tid = get_default_terrain( k - OVERMAP_DEPTH );
 
         for( int i = 0; i < OMAPX; ++i ) {
             for( int j = 0; j < OMAPY; ++j ) {
                 layer[k].terrain[i][j] = tid;
-                layer[k].visible[i][j] = false;
-                layer[k].explored[i][j] = false;
             }
         }
+        layer[k].visible.reset();
+        layer[k].explored.reset();
     }
 }
 
+uint64_t overmap::terrain_version()
+{
+    return terrain_change_counter;
+}
+
+uint64_t overmap::view_version()
+{
+    return view_change_counter;
+}
+
 void overmap::ter_set( const tripoint &p, const oter_id &id )
 {
     if( !inbounds( p ) ) {
@@ -1181,7 +1202,42 @@ void overmap::ter_set( const tripoint &p, const oter_id &id )
         return;
     }
 
-    layer[p.z + OVERMAP_DEPTH].terrain[p.x][p.y] = id;
+    oter_id &current = layer[p.z + OVERMAP_DEPTH].terrain[p.x][p.y];
+    if( current != id ) {
+        ++terrain_change_counter;
+    }
+    if( terrain_index_built && current != id ) {
+        const uint32_t index = terrain_index_of( p );
+        std::vector<uint32_t> &old_list = terrain_index[current];
+        const auto old_it = std::lower_bound( old_list.begin(), old_list.end(), index );
+        if( old_it != old_list.end() && *old_it == index ) {
+            old_list.erase( old_it );
+        }
+        if( old_list.empty() ) {
+            terrain_index.erase( current );
+        }
+        std::vector<uint32_t> &new_list = terrain_index[id];
+        new_list.insert( std::lower_bound( new_list.begin(), new_list.end(), index ), index );
+    }
+    current = id;
+}
+
+const std::unordered_map<oter_id, std::vector<uint32_t>> &overmap::terrain_locations() const
+{
+    if( !terrain_index_built ) {
+        terrain_index.clear();
+        // Walking in index order leaves every list sorted
+        for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; ++z ) {
+            const map_layer &l = layer[z + OVERMAP_DEPTH];
+            for( int y = 0; y < OMAPY; ++y ) {
+                for( int x = 0; x < OMAPX; ++x ) {
+                    terrain_index[l.terrain[x][y]].push_back( terrain_index_of( tripoint( x, y, z ) ) );
+                }
+            }
+        }
+        terrain_index_built = true;
+    }
+    return terrain_index;
 }
 
 const oter_id &overmap::ter( const tripoint &p ) const
@@ -1194,55 +1250,129 @@ const oter_id &overmap::ter( const tripoint &p ) const
     return layer[p.z + OVERMAP_DEPTH].terrain[p.x][p.y];
 }
 
-bool &overmap::seen( const tripoint &p )
+bool overmap::seen( const tripoint &p ) const
 {
     if( !inbounds( p ) ) {
-        nullbool = false;
-        return nullbool;
+        return false;
     }
-    return layer[p.z + OVERMAP_DEPTH].visible[p.x][p.y];
+    return layer[p.z + OVERMAP_DEPTH].visible.test( p.xy() );
 }
 
-bool overmap::seen( const tripoint &p ) const
+void overmap::set_seen( const tripoint &p, bool seen )
 {
     if( !inbounds( p ) ) {
-        return false;
+        return;
+    }
+    om_bit_layer &visible = layer[p.z + OVERMAP_DEPTH].visible;
+    if( visible.test( p.xy() ) != seen ) {
+        visible.set( p.xy(), seen );
+        ++view_change_counter;
     }
-    return layer[p.z + OVERMAP_DEPTH].visible[p.x][p.y];
 }
 
-bool &overmap::explored( const tripoint &p )
+bool overmap::is_explored( const tripoint &p ) const
 {
     if( !inbounds( p ) ) {
-        nullbool = false;
-        return nullbool;
+        return false;
     }
-    return layer[p.z + OVERMAP_DEPTH].explored[p.x][p.y];
+    return layer[p.z + OVERMAP_DEPTH].explored.test( p.xy() );
 }
 
-bool overmap::is_explored( const tripoint &p ) const
+void overmap::set_explored( const tripoint &p, bool explored )
 {
     if( !inbounds( p ) ) {
+        return;
+    }
+    om_bit_layer &explored_layer = layer[p.z + OVERMAP_DEPTH].explored;
+    if( explored_layer.test( p.xy() ) != explored ) {
+        explored_layer.set( p.xy(), explored );
+        ++view_change_counter;
+    }
+}
+
+bool overmap::reveal_row( const tripoint &p, int x_end )
+{
+    const int x_begin = std::max( p.x, 0 );
+    x_end = std::min( x_end, OMAPX );
+    if( x_begin >= x_end || !inbounds( tripoint( x_begin, p.y, p.z ) ) ) {
         return false;
     }
-    return layer[p.z + OVERMAP_DEPTH].explored[p.x][p.y];
+    if( !layer[p.z + OVERMAP_DEPTH].visible.set_range( p.y * OMAPX + x_begin, p.y * OMAPX + x_end ) ) {
+        return false;
+    }
+    ++view_change_counter;
+    return true;
+}
+
+static int lowest_set_bit( uint64_t bits )
+{
+#if defined(__GNUC__)
+    return __builtin_ctzll( bits );
+#else
+    int result = 0;
+    while( !( bits & 1 ) ) {
+        bits >>= 1;
+        result++;
+    }
+    return result;
+#endif
+}
+
+constexpr int om_bit_layer::bit_count;
+constexpr int om_bit_layer::bits_per_word;
+constexpr int om_bit_layer::word_count;
+
+bool om_bit_layer::set_range( int begin, int end )
+{
+    bool changed = false;
+    while( begin < end ) {
+        const int word = begin / bits_per_word;
+        const int first = begin % bits_per_word;
+        const int last = std::min( end - word * bits_per_word, bits_per_word );
+        uint64_t mask = ~uint64_t( 0 ) << first;
+        if( last < bits_per_word ) {
+            mask &= ~( ~uint64_t( 0 ) << last );
+        }
+        changed |= ( words[word] & mask ) != mask;
+        words[word] |= mask;
+        begin = ( word + 1 ) * bits_per_word;
+    }
+    return changed;
+}
+
+int om_bit_layer::find_next( int from, bool value ) const
+{
+    int word = from / bits_per_word;
+    if( word >= word_count ) {
+        return bit_count;
+    }
+    // Look for set bits, inverting the words when searching for unset ones
+    const uint64_t flip = value ? 0 : ~uint64_t( 0 );
+    uint64_t bits = ( words[word] ^ flip ) & ( ~uint64_t( 0 ) << ( from % bits_per_word ) );
+    while( bits == 0 ) {
+        if( ++word >= word_count ) {
+            return bit_count;
+        }
+        bits = words[word] ^ flip;
+    }
+    return std::min( word * bits_per_word + lowest_set_bit( bits ), bit_count );
 }
 
 bool overmap::mongroup_check( const mongroup &candidate ) const
 {
-    const auto matching_range = zg.equal_range( candidate.pos );
-    return std::find_if( matching_range.first, matching_range.second,
-    [candidate]( const std::pair<tripoint, mongroup> &match ) {
+    bool found = false;
+    zg.for_each_at( candidate.pos, [&]( const mongroup & match ) {
         // This is extra strict since we're using it to test serialization.
-        return candidate.type == match.second.type && candidate.pos == match.second.pos &&
-               candidate.radius == match.second.radius &&
-               candidate.population == match.second.population &&
-               candidate.target == match.second.target &&
-               candidate.interest == match.second.interest &&
-               candidate.dying == match.second.dying &&
-               candidate.horde == match.second.horde &&
-               candidate.diffuse == match.second.diffuse;
-    } ) != matching_range.second;
+        found = found || ( candidate.type == match.type && candidate.pos == match.pos &&
+                           candidate.radius == match.radius &&
+                           candidate.population == match.population &&
+                           candidate.target == match.target &&
+                           candidate.interest == match.interest &&
+                           candidate.dying == match.dying &&
+                           candidate.horde == match.horde &&
+                           candidate.diffuse == match.diffuse );
+    } );
+    return found;
 }
 
 bool overmap::monster_check( const std::pair<tripoint, monster> &candidate ) const
@@ -1569,39 +1699,119 @@ void overmap::generate( const overmap *north, const overmap *east,
         return pl.special_details->flags.count( "ENDGAME" );
     } );
 
-    populate_connections_out_from_neighbors( north, east, south, west );
+    overmap_generation_timings &timings = overmap_generation_timings::get();
+    const auto stage = [&timings]( const std::string & name, const std::function<void()> &run ) {
+        const auto start = std::chrono::steady_clock::now();
+        run();
+        timings.add( name, std::chrono::duration_cast<std::chrono::microseconds>(
+                         std::chrono::steady_clock::now() - start ) );
+    };
+    const auto generation_start = std::chrono::steady_clock::now();
+
+    // The noise layers depend on nothing but the seed and the location,
+    // so they are sampled on other threads while the rivers are laid out.
+    const point base = global_base_point();
+    const unsigned seed = g->get_seed();
+    std::future<om_noise::om_noise_grid<om_noise::om_noise_layer_lake>> lake_noise =
+    std::async( std::launch::async, [base, seed]() {
+        return om_noise::om_noise_grid<om_noise::om_noise_layer_lake>( base, seed );
+    } );
+    std::future<om_noise::om_noise_grid<om_noise::om_noise_layer_forest>> forest_noise =
+    std::async( std::launch::async, [base, seed]() {
+        return om_noise::om_noise_grid<om_noise::om_noise_layer_forest>( base, seed );
+    } );
+    std::future<om_noise::om_noise_grid<om_noise::om_noise_layer_floodplain>> floodplain_noise =
+    std::async( std::launch::async, [base, seed]() {
+        return om_noise::om_noise_grid<om_noise::om_noise_layer_floodplain>( base, seed );
+    } );
 
-    place_rivers( north, east, south, west );
-    place_lakes();
-    place_forests();
-    place_swamps();
-    place_cities();
-    place_forest_trails();
-    place_roads( north, east, south, west );
-    place_specials( enabled_specials );
-    place_forest_trailheads();
+    populate_connections_out_from_neighbors( north, east, south, west );
 
-    polish_river();
+    stage( "rivers", [&]() {
+        place_rivers( north, east, south, west );
+    } );
+    // Time spent waiting for the noise counts towards the stage that needs it
+    stage( "lakes", [&]() {
+        place_lakes( lake_noise.get() );
+    } );
+    stage( "forests", [&]() {
+        place_forests( forest_noise.get() );
+    } );
+    stage( "swamps", [&]() {
+        place_swamps( floodplain_noise.get() );
+    } );
+    stage( "cities", [&]() {
+        place_cities();
+    } );
+    stage( "forest trails", [&]() {
+        place_forest_trails();
+    } );
+    stage( "roads", [&]() {
+        place_roads( north, east, south, west );
+    } );
+    stage( "specials", [&]() {
+        place_specials( enabled_specials );
+    } );
+    stage( "forest trailheads", [&]() {
+        place_forest_trailheads();
+    } );
+    stage( "polish rivers", [&]() {
+        polish_river();
+    } );
 
     // TODO: there is no reason we can't generate the sublevels in one pass
     //       for that matter there is no reason we can't as we add the entrance ways either
 
-    // Always need at least one sublevel, but how many more
-    int z = -1;
-    bool requires_sub = false;
-    do {
-        requires_sub = generate_sub( z );
-    } while( requires_sub && ( --z >= -OVERMAP_DEPTH ) );
+    stage( "underground", [&]() {
+        // Always need at least one sublevel, but how many more
+        int z = -1;
+        bool requires_sub = false;
+        do {
+            requires_sub = generate_sub( z );
+        } while( requires_sub && ( --z >= -OVERMAP_DEPTH ) );
 
-    // We don't need it if we're in a test method or a mod that doesn't have endgame
-    if( needs_endgame ) {
-        fixup_labs( *this );
-    }
+        // We don't need it if we're in a test method or a mod that doesn't have endgame
+        if( needs_endgame ) {
+            fixup_labs( *this );
+        }
+    } );
 
     // Place the monsters, now that the terrain is laid out
-    place_mongroups();
-    place_radios();
-    dbg( DL::Info ) << "overmap::generate done";
+    stage( "monster groups", [&]() {
+        place_mongroups();
+    } );
+    stage( "radios", [&]() {
+        place_radios();
+    } );
+    timings.overmaps++;
+    dbg( DL::Info ) << "overmap::generate done in " <<
+                    std::chrono::duration_cast<std::chrono::milliseconds>(
+                        std::chrono::steady_clock::now() - generation_start ).count() << " ms";
+}
+
+void overmap_generation_timings::add( const std::string &stage, std::chrono::microseconds spent )
+{
+    const auto found = std::find_if( stages.begin(), stages.end(),
+    [&stage]( const std::pair<std::string, std::chrono::microseconds> &entry ) {
+        return entry.first == stage;
+    } );
+    if( found == stages.end() ) {
+        stages.emplace_back( stage, spent );
+    } else {
+        found->second += spent;
+    }
+}
+
+void overmap_generation_timings::reset()
+{
+    stages.clear();
+    overmaps = 0;
+}
+
+overmap_generation_timings &overmap_generation_timings::get()
+{
+    static overmap_generation_timings timings;
+    return timings;
 }
 
 bool overmap::generate_sub( const int z )
@@ -1951,18 +2161,13 @@ tripoint overmap::find_random_omt( const std::pair<std::string, ot_match_type> &
 
 void overmap::process_mongroups()
 {
-    for( auto it = zg.begin(); it != zg.end(); ) {
-        mongroup &mg = it->second;
+    zg.erase_if( []( mongroup & mg ) {
         if( mg.dying ) {
             mg.population = ( mg.population * 4 ) / 5;
             mg.radius = ( mg.radius * 9 ) / 10;
         }
-        if( mg.empty() ) {
-            zg.erase( it++ );
-        } else {
-            ++it;
-        }
-    }
+        return mg.empty();
+    } );
 }
 
 void overmap::clear_mon_groups()
@@ -2027,14 +2232,11 @@ void mongroup::wander( const overmap &om )
 
 void overmap::move_hordes()
 {
-    // Prevent hordes to be moved twice by putting them in here after moving.
-    decltype( zg ) tmpzg;
     //MOVE ZOMBIE GROUPS
-    for( auto it = zg.begin(); it != zg.end(); ) {
-        mongroup &mg = it->second;
+    // Groups stay in place while moving, only their grid bucket changes.
+    zg.for_each( [&]( const mongroup_grid::handle & h, mongroup & mg ) {
         if( !mg.horde ) {
-            ++it;
-            continue;
+            return;
         }
 
         if( mg.horde_behaviour.empty() ) {
@@ -2069,28 +2271,22 @@ void overmap::move_hordes()
         // or one space per 5 minutes.
         if( one_in( movement_chance ) && rng( 0, 100 ) < mg.interest && rng( 0, 200 ) < mg.avg_speed() ) {
             // TODO: Handle moving to adjacent overmaps.
-            if( mg.pos.x > mg.target.x ) {
-                mg.pos.x--;
+            tripoint new_pos = mg.pos;
+            if( new_pos.x > mg.target.x ) {
+                new_pos.x--;
             }
-            if( mg.pos.x < mg.target.x ) {
-                mg.pos.x++;
+            if( new_pos.x < mg.target.x ) {
+                new_pos.x++;
             }
-            if( mg.pos.y > mg.target.y ) {
-                mg.pos.y--;
+            if( new_pos.y > mg.target.y ) {
+                new_pos.y--;
             }
-            if( mg.pos.y < mg.target.y ) {
-                mg.pos.y++;
+            if( new_pos.y < mg.target.y ) {
+                new_pos.y++;
             }
-
-            // Erase the group at it's old location, add the group with the new location
-            tmpzg.insert( std::pair<tripoint, mongroup>( mg.pos, mg ) );
-            zg.erase( it++ );
-        } else {
-            ++it;
+            zg.move( h, new_pos );
         }
-    }
-    // and now back into the monster group map.
-    zg.insert( tmpzg.begin(), tmpzg.end() );
+    } );
 
     if( get_option<bool>( "WANDER_SPAWNS" ) ) {
 
@@ -2124,12 +2320,8 @@ void overmap::move_hordes()
 
             // Scan for compatible hordes in this area, selecting the largest.
             mongroup *add_to_group = nullptr;
-            auto group_bucket = zg.equal_range( p );
             std::vector<monster>::size_type add_to_horde_size = 0;
-            std::for_each( group_bucket.first, group_bucket.second,
-            [&]( std::pair<const tripoint, mongroup> &horde_entry ) {
-                mongroup &horde = horde_entry.second;
-
+            zg.for_each_at( p, [&]( mongroup & horde ) {
                 // We only absorb zombies into GROUP_ZOMBIE hordes
                 if( horde.horde && !horde.monsters.empty() && horde.type == GROUP_ZOMBIE &&
                     horde.monsters.size() > add_to_horde_size ) {
@@ -2168,14 +2360,15 @@ void overmap::move_hordes()
 */
 void overmap::signal_hordes( const tripoint &p, const int sig_power )
 {
-    for( auto &elem : zg ) {
-        mongroup &mg = elem.second;
+    // Anything farther than sig_power in any direction is out of earshot
+    const tripoint reach( sig_power, sig_power, sig_power );
+    zg.for_each_in( p - reach, p + reach, [&]( mongroup & mg ) {
         if( !mg.horde ) {
-            continue;
+            return;
         }
         const int dist = rl_dist( p, mg.pos );
         if( sig_power < dist ) {
-            continue;
+            return;
         }
         // TODO: base this in monster attributes, foremost GOODHEARING.
         const int inter_per_sig_power = 15; //Interest per signal value
@@ -2200,7 +2393,7 @@ void overmap::signal_hordes( const tripoint &p, const int sig_power )
                 add_msg( m_debug, "horde set interest %d dist %d", min_capped_inter, dist );
             }
         }
-    }
+    } );
 }
 
 void overmap::populate_connections_out_from_neighbors( const overmap *north, const overmap *east,
@@ -2422,14 +2615,12 @@ void overmap::place_forest_trailheads()
     }
 }
 
-void overmap::place_forests()
+void overmap::place_forests( const om_noise::om_noise_grid<om_noise::om_noise_layer_forest> &f )
 {
     const oter_id default_oter_id( settings->default_oter );
     const oter_id forest( "forest" );
     const oter_id forest_thick( "forest_thick" );
 
-    const om_noise::om_noise_layer_forest f( global_base_point(), g->get_seed() );
-
     for( int x = 0; x < OMAPX; x++ ) {
         for( int y = 0; y < OMAPY; y++ ) {
             const tripoint p( x, y, 0 );
@@ -2453,10 +2644,8 @@ void overmap::place_forests()
     }
 }
 
-void overmap::place_lakes()
+void overmap::place_lakes( const om_noise::om_noise_grid<om_noise::om_noise_layer_lake> &f )
 {
-    const om_noise::om_noise_layer_lake f( global_base_point(), g->get_seed() );
-
     const auto is_lake = [&]( const point & p ) {
         return f.noise_at( p ) > settings->overmap_lake.noise_threshold_lake;
     };
@@ -2743,7 +2932,7 @@ void overmap::place_rivers( const overmap *north, const overmap *east, const ove
     }
 }
 
-void overmap::place_swamps()
+void overmap::place_swamps( const om_noise::om_noise_grid<om_noise::om_noise_layer_floodplain> &f )
 {
     // Buffer our river terrains by a variable radius and increment a counter for the location each
     // time it's included in a buffer. It's a floodplain that we'll then intersect later with some
@@ -2769,9 +2958,7 @@ void overmap::place_swamps()
 
     const oter_id forest_water( "forest_water" );
 
-    // Get a layer of noise to use in conjunction with our river buffered floodplain.
-    const om_noise::om_noise_layer_floodplain f( global_base_point(), g->get_seed() );
-
+    // The layer of noise f is used in conjunction with our river buffered floodplain.
     for( int x = 0; x < OMAPX; x++ ) {
         for( int y = 0; y < OMAPY; y++ ) {
             const tripoint pos( x, y, 0 );
@@ -4039,7 +4226,7 @@ om_direction::type overmap::random_special_rotation( const overmap_special &spec
             }
             const oter_id &oter = ter( rp );
 
-            if( is_ot_match( con.terrain.str(), oter, ot_match_type::type ) ) {
+            if( oter->get_type_id() == con.terrain ) {
                 ++score; // Found another one satisfied connection.
             } else if( !oter || con.existing || !con.connection->pick_subtype_for( oter ) ) {
                 valid = false;
@@ -4232,6 +4419,7 @@ bool overmap::place_special_attempt( overmap_special_batch &enabled_specials,
 
     const tripoint p( rng( x, x + sector_width - 1 ), rng( y, y + sector_width - 1 ), 0 );
     const city &nearest_city = get_nearest_city( p );
+    const oter_id &anchor_ter = ter( p );
 
     std::shuffle( enabled_specials.begin(), enabled_specials.end(), rng_get_engine() );
     for( auto iter = enabled_specials.begin(); iter != enabled_specials.end(); ++iter ) {
@@ -4245,6 +4433,12 @@ bool overmap::place_special_attempt( overmap_special_batch &enabled_specials,
         if( !special.can_belong_to_city( p, nearest_city ) ) {
             continue;
         }
+        // The terrain at the origin of the special stays at p in every rotation,
+        // which rules out most specials before any rotation is tried.
+        const overmap_special_terrain &anchor = special.get_terrain_at( tripoint_zero );
+        if( anchor.terrain && !anchor.can_be_placed_on( anchor_ter ) ) {
+            continue;
+        }
         // See if we can actually place the special there.
         const auto rotation = random_special_rotation( special, p, must_be_unexplored );
         if( rotation == om_direction::type::invalid ) {
@@ -4640,7 +4834,7 @@ void overmap::add_mon_group( const mongroup &group )
     // makes the diffuse setting obsolete (as it only controls how the radius
     // is interpreted) - it's only used when adding monster groups with function.
     if( group.radius == 1 ) {
-        zg.insert( std::pair<tripoint, mongroup>( group.pos, group ) );
+        zg.insert( group );
         return;
     }
     // diffuse groups use a circular area, non-diffuse groups use a rectangular area
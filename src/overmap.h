@@ -4,7 +4,9 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <climits>
+#include <cstdint>
 #include <cstdlib>
 #include <functional>
 #include <iosfwd>
@@ -22,6 +24,7 @@
 #include "game_constants.h"
 #include "memory_fast.h"
 #include "mongroup.h"
+#include "mongroup_grid.h"
 #include "omdata.h"
 #include "optional.h"
 #include "overmap_types.h" // IWYU pragma: keep
@@ -47,6 +50,29 @@ namespace pf
 struct path;
 } // namespace pf
 
+namespace om_noise
+{
+template<typename Layer> class om_noise_grid;
+class om_noise_layer_floodplain;
+class om_noise_layer_forest;
+class om_noise_layer_lake;
+} // namespace om_noise
+
+/**
+ * Wall clock time spent in each stage of overmap generation, summed over all
+ * overmaps generated since the last @ref reset.
+ */
+struct overmap_generation_timings {
+    /** Stage names in the order they first ran, with the total time spent in each. */
+    std::vector<std::pair<std::string, std::chrono::microseconds>> stages;
+    int overmaps = 0;
+
+    void add( const std::string &stage, std::chrono::microseconds spent );
+    void reset();
+
+    static overmap_generation_timings &get();
+};
+
 struct city {
     // location of the city (in overmap terrain coordinates)
     point pos;
@@ -125,10 +151,63 @@ struct radio_tower {
                  radio_type T = radio_type::MESSAGE_BROADCAST );
 };
 
+/**
+ * One bit for each overmap terrain tile of a single z-level.
+ * Bits are stored row by row (index y * OMAPX + x), which is also the order
+ * of the run-length encoded sequences in the save files.
+ */
+class om_bit_layer
+{
+    public:
+        static constexpr int bit_count = OMAPX * OMAPY;
+
+        om_bit_layer() {
+            reset();
+        }
+
+        bool test( const point &p ) const {
+            const int bit = index_of( p );
+            return ( words[bit / bits_per_word] >> ( bit % bits_per_word ) ) & 1;
+        }
+        void set( const point &p, bool value ) {
+            const int bit = index_of( p );
+            const uint64_t mask = uint64_t( 1 ) << ( bit % bits_per_word );
+            if( value ) {
+                words[bit / bits_per_word] |= mask;
+            } else {
+                words[bit / bits_per_word] &= ~mask;
+            }
+        }
+        /**
+         * Sets the bits from index @p begin up to, but not including, @p end.
+         * @return Whether any of them was unset before.
+         */
+        bool set_range( int begin, int end );
+        /** Sets the bits of row @p y from @p x_begin up to, but not including, @p x_end. */
+        bool set_row( int y, int x_begin, int x_end ) {
+            return set_range( y * OMAPX + x_begin, y * OMAPX + x_end );
+        }
+        void reset() {
+            words.fill( 0 );
+        }
+        /** Index of the first bit at or after @p from that equals @p value, or bit_count if none. */
+        int find_next( int from, bool value ) const;
+
+    private:
+        static constexpr int bits_per_word = 64;
+        static constexpr int word_count = ( bit_count + bits_per_word - 1 ) / bits_per_word;
+
+        static int index_of( const point &p ) {
+            return p.y * OMAPX + p.x;
+        }
+
+        std::array<uint64_t, word_count> words;
+};
+
 struct map_layer {
     oter_id terrain[OMAPX][OMAPY];
-    bool visible[OMAPX][OMAPY];
-    bool explored[OMAPX][OMAPY];
+    om_bit_layer visible;
+    om_bit_layer explored;
     std::vector<om_note> notes;
     std::vector<om_map_extra> extras;
 };
@@ -261,10 +340,32 @@ class overmap
 
         void ter_set( const tripoint &p, const oter_id &id );
         const oter_id &ter( const tripoint &p ) const;
-        bool &seen( const tripoint &p );
+        /**
+         * Local locations of every terrain on this overmap, encoded by @ref terrain_index_of.
+         * Each list is sorted. Built on first use, kept current by @ref ter_set.
+         */
+        const std::unordered_map<oter_id, std::vector<uint32_t>> &terrain_locations() const;
+        /** Grows whenever @ref ter_set changes the terrain of any overmap, or an overmap is created. */
+        static uint64_t terrain_version();
+        /** Grows whenever the seen or explored state of any overmap changes, or an overmap is created. */
+        static uint64_t view_version();
+        static uint32_t terrain_index_of( const tripoint &p ) {
+            return ( p.z + OVERMAP_DEPTH ) * OMAPX * OMAPY + p.y * OMAPX + p.x;
+        }
+        static tripoint terrain_index_point( uint32_t index ) {
+            return tripoint( index % OMAPX, index / OMAPX % OMAPY,
+                             static_cast<int>( index / ( OMAPX * OMAPY ) ) - OVERMAP_DEPTH );
+        }
         bool seen( const tripoint &p ) const;
-        bool &explored( const tripoint &p );
+        void set_seen( const tripoint &p, bool seen );
         bool is_explored( const tripoint &p ) const;
+        void set_explored( const tripoint &p, bool explored );
+        /**
+         * Marks the tiles of row @p p.y on level @p p.z from @p p.x up to, but not
+         * including, @p x_end as seen. Out of bounds parts are ignored.
+         * @return Whether any of them was not seen before.
+         */
+        bool reveal_row( const tripoint &p, int x_end );
 
         bool has_note( const tripoint &p ) const;
         cata::optional<int> has_note_with_danger_radius( const tripoint &p ) const;
@@ -340,7 +441,7 @@ class overmap
         void place_special_forced( const overmap_special_id &special_id, const tripoint &p,
                                    om_direction::type dir );
     private:
-        std::multimap<tripoint, mongroup> zg;
+        mongroup_grid zg;
     public:
         /** Unit test enablers to check if a given mongroup is present. */
         bool mongroup_check( const mongroup &candidate ) const;
@@ -384,12 +485,14 @@ class overmap
 
         std::vector<shared_ptr_fast<npc>> npcs;
 
-        bool nullbool = false;
         point loc = point_zero;
 
         std::array<map_layer, OVERMAP_LAYERS> layer;
         std::unordered_map<tripoint, scent_trace> scents;
 
+        mutable std::unordered_map<oter_id, std::vector<uint32_t>> terrain_index;
+        mutable bool terrain_index_built = false;
+
         // Records the locations where a given overmap special was placed, which
         // can be used after placement to lookup whether a given location was created
         // as part of a special.
@@ -439,11 +542,11 @@ class overmap
 
         // Overall terrain
         void place_river( point pa, point pb );
-        void place_forests();
-        void place_lakes();
+        void place_forests( const om_noise::om_noise_grid<om_noise::om_noise_layer_forest> &f );
+        void place_lakes( const om_noise::om_noise_grid<om_noise::om_noise_layer_lake> &f );
         void place_rivers( const overmap *north, const overmap *east, const overmap *south,
                            const overmap *west );
-        void place_swamps();
+        void place_swamps( const om_noise::om_noise_grid<om_noise::om_noise_layer_floodplain> &f );
         void place_forest_trails();
         void place_forest_trailheads();
 
@@ -32,6 +32,15 @@ const overmap_location &string_id<overmap_location>::obj() const
 }
 
 bool overmap_location::test( const int_id<oter_t> &oter ) const
+{
+    const size_t index = static_cast<size_t>( oter.to_i() );
+    if( index < matches.size() ) {
+        return matches[index];
+    }
+    return test_terrains( oter );
+}
+
+bool overmap_location::test_terrains( const int_id<oter_t> &oter ) const
 {
     return std::any_of( terrains.cbegin(), terrains.cend(),
     [ &oter ]( const oter_type_str_id & type ) {
@@ -85,6 +94,16 @@ void overmap_location::finalize()
             }
         }
     }
+
+    // Overmap specials test locations over and over again while being placed
+    matches.clear();
+    for( const oter_t &ter_elem : overmap_terrains::get_all() ) {
+        const size_t index = static_cast<size_t>( ter_elem.id.id().to_i() );
+        if( index >= matches.size() ) {
+            matches.resize( index + 1, false );
+        }
+        matches[index] = test_terrains( ter_elem.id.id() );
+    }
 }
 
 void overmap_locations::load( const JsonObject &jo, const std::string &src )
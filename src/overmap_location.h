@@ -32,8 +32,12 @@ struct overmap_location {
         bool was_loaded = false;
 
     private:
+        bool test_terrains( const int_id<oter_t> &oter ) const;
+
         std::vector<oter_type_str_id> terrains;
         std::vector<std::string> flags;
+        /** Result of @ref test for every overmap terrain, indexed by its int id. Built in finalize. */
+        std::vector<bool> matches;
 };
 
 namespace overmap_locations
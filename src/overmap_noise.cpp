@@ -1,5 +1,6 @@
 #include <cmath>
 #include <algorithm>
+#include <vector>
 
 #include "overmap_noise.h"
 #include "simplexnoise.h"
@@ -7,6 +8,17 @@
 namespace om_noise
 {
 
+void om_noise_layer::fill_grid( std::vector<float> &values ) const
+{
+    values.clear();
+    values.reserve( OMAPX * OMAPY );
+    for( int x = 0; x < OMAPX; x++ ) {
+        for( int y = 0; y < OMAPY; y++ ) {
+            values.push_back( noise_at( point( x, y ) ) );
+        }
+    }
+}
+
 float om_noise_layer_forest::noise_at( const point &local_omt_pos ) const
 {
     const point p = global_omt_pos( local_omt_pos );
@@ -19,6 +31,22 @@ float om_noise_layer_forest::noise_at( const point &local_omt_pos ) const
     return std::max( 0.0f, r - d * 0.5f );
 }
 
+void om_noise_layer_forest::fill_grid( std::vector<float> &values ) const
+{
+    const point p = global_omt_pos( point_zero );
+    std::vector<float> detail( OMAPX * OMAPY );
+    values.resize( OMAPX * OMAPY );
+    scaled_octave_noise_3d_grid( 8, 0.5, 0.03, 0, 1, p.x, p.y, OMAPX, OMAPY, get_seed(),
+                                 values.data() );
+    scaled_octave_noise_3d_grid( 12, 0.5, 0.07, 0, 1, p.x, p.y, OMAPX, OMAPY, get_seed(),
+                                 detail.data() );
+    for( size_t i = 0; i < values.size(); i++ ) {
+        const float r = std::pow( values[i], 2.0f );
+        const float d = std::pow( detail[i], 3.0f );
+        values[i] = std::max( 0.0f, r - d * 0.5f );
+    }
+}
+
 float om_noise_layer_floodplain::noise_at( const point &local_omt_pos ) const
 {
     const point p = global_omt_pos( local_omt_pos );
@@ -27,6 +55,17 @@ float om_noise_layer_floodplain::noise_at( const point &local_omt_pos ) const
     return r;
 }
 
+void om_noise_layer_floodplain::fill_grid( std::vector<float> &values ) const
+{
+    const point p = global_omt_pos( point_zero );
+    values.resize( OMAPX * OMAPY );
+    scaled_octave_noise_3d_grid( 8, 0.5, 0.05, 0, 1, p.x, p.y, OMAPX, OMAPY, get_seed(),
+                                 values.data() );
+    for( float &r : values ) {
+        r = std::pow( r, 2.0f );
+    }
+}
+
 float om_noise_layer_lake::noise_at( const point &local_omt_pos ) const
 {
     const point p = global_omt_pos( local_omt_pos );
@@ -35,4 +74,15 @@ float om_noise_layer_lake::noise_at( const point &local_omt_pos ) const
     return r;
 }
 
+void om_noise_layer_lake::fill_grid( std::vector<float> &values ) const
+{
+    const point p = global_omt_pos( point_zero );
+    values.resize( OMAPX * OMAPY );
+    scaled_octave_noise_3d_grid( 16, 0.5, 0.002, 0, 1, p.x, p.y, OMAPX, OMAPY, get_seed(),
+                                 values.data() );
+    for( float &r : values ) {
+        r = std::pow( r, 4.0f );
+    }
+}
+
 } // namespace om_noise
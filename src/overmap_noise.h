@@ -2,6 +2,8 @@
 #ifndef CATA_SRC_OVERMAP_NOISE_H
 #define CATA_SRC_OVERMAP_NOISE_H
 
+#include <vector>
+
 #include "game_constants.h"
 #include "point.h"
 
@@ -20,6 +22,11 @@ class om_noise_layer
          * @param omt_local point location in overmap terrain local coordinates.
          */
         virtual float noise_at( const point &omt_local ) const = 0;
+        /**
+         * Noise at every location of the overmap, values[x * OMAPY + y] holds the noise at (x, y).
+         * Matches @ref noise_at exactly, layers override it to sample the whole overmap at once.
+         */
+        virtual void fill_grid( std::vector<float> &values ) const;
         virtual ~om_noise_layer() = default;
     protected:
         /**
@@ -55,6 +62,7 @@ class om_noise_layer_forest : public om_noise_layer
         }
 
         float noise_at( const point &local_omt_pos ) const override;
+        void fill_grid( std::vector<float> &values ) const override;
 };
 
 class om_noise_layer_floodplain : public om_noise_layer
@@ -65,6 +73,7 @@ class om_noise_layer_floodplain : public om_noise_layer
         }
 
         float noise_at( const point &local_omt_pos ) const override;
+        void fill_grid( std::vector<float> &values ) const override;
 };
 
 class om_noise_layer_lake : public om_noise_layer
@@ -75,6 +84,33 @@ class om_noise_layer_lake : public om_noise_layer
         }
 
         float noise_at( const point &local_omt_pos ) const override;
+        void fill_grid( std::vector<float> &values ) const override;
+};
+
+/**
+ * A noise layer sampled once at every location of an overmap, so repeated lookups are cheap
+ * and the sampling can be done ahead of time. Locations off the overmap are passed on to the layer.
+ */
+template<typename Layer>
+class om_noise_grid
+{
+    public:
+        om_noise_grid( const point &global_base_point, unsigned seed )
+            : layer( global_base_point, seed ) {
+            layer.fill_grid( values );
+        }
+
+        float noise_at( const point &local_omt_pos ) const {
+            if( local_omt_pos.x < 0 || local_omt_pos.x >= OMAPX ||
+                local_omt_pos.y < 0 || local_omt_pos.y >= OMAPY ) {
+                return layer.noise_at( local_omt_pos );
+            }
+            return values[local_omt_pos.x * OMAPY + local_omt_pos.y];
+        }
+
+    private:
+        Layer layer;
+        std::vector<float> values;
 };
 
 } // namespace om_noise
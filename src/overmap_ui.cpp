@@ -4,6 +4,7 @@
 #include <array>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <list>
 #include <map>
 #include <memory>
@@ -12,6 +13,7 @@
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -745,6 +747,92 @@ static tripoint show_notes_manager( const tripoint &origin )
     return result;
 }
 
+/** Glyph of a tile when nothing else is displayed on top of its terrain. */
+struct terrain_glyph {
+    oter_id ter = oter_str_id::NULL_ID();
+    nc_color color = c_dark_gray;
+    // Index into terrain_glyph_layer::symbols
+    uint16_t sym = 0;
+    bool see = false;
+};
+
+/**
+ * Terrain glyphs of one level of one overmap, kept between redraws.
+ * They are rebuilt once terrain, seen state or display options change.
+ */
+struct terrain_glyph_layer {
+    uint64_t terrain_version = 0;
+    uint64_t view_version = 0;
+    int options = -1;
+    bool used = false;
+    // Indexed by x * OMAPY + y of the overmap local position
+    std::vector<terrain_glyph> tiles;
+    std::vector<std::string> symbols;
+};
+
+// Keyed by overmap position and z-level, holds only the layers of the last redraw
+static std::map<tripoint, terrain_glyph_layer> terrain_glyph_cache;
+
+static const terrain_glyph_layer &get_terrain_glyphs( const tripoint &om_pos,
+        bool has_debug_vision, bool show_explored )
+{
+    const bool land_use_codes = uistate.overmap_show_land_use_codes;
+    const int options = ( has_debug_vision ? 1 : 0 ) | ( show_explored ? 2 : 0 ) |
+                        ( land_use_codes ? 4 : 0 ) | ( uistate.overmap_show_forest_trails ? 8 : 0 );
+    terrain_glyph_layer &glyphs = terrain_glyph_cache[om_pos];
+    glyphs.used = true;
+    if( glyphs.options == options && glyphs.terrain_version == overmap::terrain_version() &&
+        glyphs.view_version == overmap::view_version() ) {
+        return glyphs;
+    }
+
+    // Debug vision shows everything, even overmaps that were not generated yet
+    const overmap *om = has_debug_vision ? &overmap_buffer.get( om_pos.xy() ) :
+                        overmap_buffer.get_existing( om_pos.xy() );
+    glyphs.options = options;
+    glyphs.terrain_version = overmap::terrain_version();
+    glyphs.view_version = overmap::view_version();
+    glyphs.tiles.assign( OMAPX * OMAPY, terrain_glyph() );
+    glyphs.symbols.assign( 1, "#" );
+    if( !om ) {
+        return glyphs;
+    }
+
+    const oter_id forest = oter_str_id( "forest" ).id();
+    // Terrain comes in clumps, so remember what the previous tile was drawn as
+    oter_id prev_ter = oter_str_id::NULL_ID();
+    const oter_t *prev_info = nullptr;
+    uint16_t prev_sym = 0;
+    for( int x = 0; x < OMAPX; ++x ) {
+        for( int y = 0; y < OMAPY; ++y ) {
+            const tripoint p( x, y, om_pos.z );
+            terrain_glyph &glyph = glyphs.tiles[x * OMAPY + y];
+            glyph.see = has_debug_vision || om->seen( p );
+            if( !glyph.see ) {
+                continue;
+            }
+            glyph.ter = om->ter( p );
+            if( !prev_info || glyph.ter != prev_ter ) {
+                prev_ter = glyph.ter;
+                // If forest trails shouldn't be displayed, render them like a forest.
+                const bool as_forest = !uistate.overmap_show_forest_trails && glyph.ter &&
+                                       is_ot_match( "forest_trail", glyph.ter, ot_match_type::type );
+                prev_info = &( as_forest ? forest : glyph.ter ).obj();
+                const std::string sym = prev_info->get_symbol( land_use_codes );
+                const auto found = std::find( glyphs.symbols.begin(), glyphs.symbols.end(), sym );
+                prev_sym = static_cast<uint16_t>( found - glyphs.symbols.begin() );
+                if( found == glyphs.symbols.end() ) {
+                    glyphs.symbols.push_back( sym );
+                }
+            }
+            const bool explored = show_explored && om->is_explored( p );
+            glyph.color = explored ? c_dark_gray : prev_info->get_color( land_use_codes );
+            glyph.sym = prev_sym;
+        }
+    }
+    return glyphs;
+}
+
 void draw( const catacurses::window &w, const catacurses::window &wbar, const tripoint &center,
            const tripoint &orig, bool blink, bool show_explored, bool fast_scroll, input_context *inp_ctxt,
            const draw_data_t &data, grids_draw_data &grids_data )
@@ -770,8 +858,6 @@ void draw( const catacurses::window &w, const catacurses::window &wbar, const tr
     // Whether showing hordes is currently enabled
     const bool showhordes = uistate.overmap_show_hordes;
 
-    const oter_id forest = oter_str_id( "forest" ).id();
-
     std::string sZoneName;
     tripoint tripointZone = tripoint( -1, -1, -1 );
     const auto &zones = zone_manager::get_manager();
@@ -795,36 +881,6 @@ void draw( const catacurses::window &w, const catacurses::window &wbar, const tr
         }
     }
 
-    // A small LRU cache: most oter_id's occur in clumps like forests of swamps.
-    // This cache helps avoid much more costly lookups in the full hashmap.
-    constexpr size_t cache_size = 8; // used below to calculate the next index
-    std::array<std::pair<oter_id, oter_t const *>, cache_size> cache {{}};
-    size_t cache_next = 0;
-
-    const auto set_color_and_symbol = [&]( const oter_id & cur_ter, const tripoint & omp,
-    std::string & ter_sym, nc_color & ter_color ) {
-        // First see if we have the oter_t cached
-        oter_t const *info = nullptr;
-        for( const auto &c : cache ) {
-            if( c.first == cur_ter ) {
-                info = c.second;
-                break;
-            }
-        }
-        // Nope, look in the hash map next
-        if( !info ) {
-            info = &cur_ter.obj();
-            cache[cache_next] = std::make_pair( cur_ter, info );
-            cache_next = ( cache_next + 1 ) % cache_size;
-        }
-        // Ok, we found something
-        if( info ) {
-            const bool explored = show_explored && overmap_buffer.is_explored( omp );
-            ter_color = explored ? c_dark_gray : info->get_color( uistate.overmap_show_land_use_codes );
-            ter_sym = info->get_symbol( uistate.overmap_show_land_use_codes );
-        }
-    };
-
     const tripoint corner = center - point( om_half_width, om_half_height );
 
     // For use with place_special: cache the color and symbol of each submap
@@ -855,8 +911,8 @@ void draw( const catacurses::window &w, const catacurses::window &wbar, const tr
         nc_color color;
         size_t count;
     };
-    std::vector<tripoint> path_route;
-    std::vector<tripoint> player_path_route;
+    std::unordered_set<tripoint> path_route;
+    std::unordered_set<tripoint> player_path_route;
     std::unordered_map<tripoint, npc_coloring> npc_color;
     if( blink ) {
         // get seen NPCs
@@ -899,13 +955,13 @@ void draw( const catacurses::window &w, const catacurses::window &wbar, const tr
             npc *npc_to_add = elem.get();
             if( npc_to_add->mission == NPC_MISSION_TRAVELLING && !npc_to_add->omt_path.empty() ) {
                 for( auto &elem : npc_to_add->omt_path ) {
-                    path_route.push_back( tripoint( elem.xy(), npc_to_add->posz() ) );
+                    path_route.insert( tripoint( elem.xy(), npc_to_add->posz() ) );
                 }
             }
         }
         for( auto &elem : g->u.omt_path ) {
             tripoint tri_to_add = tripoint( elem.xy(), g->u.posz() );
-            player_path_route.push_back( tri_to_add );
+            player_path_route.insert( tri_to_add );
         }
         for( const auto &np : followers ) {
             if( np->posz() != center.z ) {
@@ -926,35 +982,60 @@ void draw( const catacurses::window &w, const catacurses::window &wbar, const tr
         }
     }
 
+    // Notes of the overmaps in view, by absolute position
+    std::unordered_map<point, const std::string *> notes;
+    if( blink && uistate.overmap_show_map_notes ) {
+        const point om_first = omt_to_om_copy( corner.xy() );
+        const point om_last = omt_to_om_copy( corner.xy() + point( om_map_width - 1, om_map_height - 1 ) );
+        for( int x = om_first.x; x <= om_last.x; ++x ) {
+            for( int y = om_first.y; y <= om_last.y; ++y ) {
+                const overmap *om = overmap_buffer.get_existing( point( x, y ) );
+                if( !om ) {
+                    continue;
+                }
+                const point om_origin = om_to_omt_copy( point( x, y ) );
+                for( const om_note &note : om->all_notes( center.z ) ) {
+                    notes.emplace( om_origin + note.p, &note.text );
+                }
+            }
+        }
+    }
+
+    for( auto &cached : terrain_glyph_cache ) {
+        cached.second.used = false;
+    }
+    const terrain_glyph_layer *glyphs = nullptr;
+    tripoint glyphs_om_pos = overmap::invalid_tripoint;
+
     for( int i = 0; i < om_map_width; ++i ) {
         for( int j = 0; j < om_map_height; ++j ) {
             const tripoint omp = corner + point( i, j );
 
-            oter_id cur_ter = oter_str_id::NULL_ID();
+            point omp_local = omp.xy();
+            const tripoint om_pos( omt_to_om_remain( omp_local ), omp.z );
+            if( om_pos != glyphs_om_pos ) {
+                glyphs = &get_terrain_glyphs( om_pos, has_debug_vision, show_explored );
+                glyphs_om_pos = om_pos;
+            }
+            const terrain_glyph &glyph = glyphs->tiles[omp_local.x * OMAPY + omp_local.y];
+
+            const oter_id cur_ter = glyph.ter;
             nc_color ter_color = c_black;
             std::string ter_sym = " ";
 
-            const bool see = has_debug_vision || overmap_buffer.seen( omp );
-            if( see ) {
-                // Only load terrain if we can actually see it
-                cur_ter = overmap_buffer.ter( omp );
-            }
+            const bool see = glyph.see;
 
             // Check if location is within player line-of-sight
-            const bool los = see && g->u.overmap_los( omp, sight_points );
-            const bool los_sky = g->u.overmap_los( omp, sight_points * 2 );
-            int mycount = std::count( path_route.begin(), path_route.end(), omp );
-            bool player_path_count = false;
-            std::vector<tripoint>::iterator it;
-            it = std::find( player_path_route.begin(), player_path_route.end(), omp );
-            if( it != player_path_route.end() ) {
-                player_path_count = true;
-            }
+            const auto los = [&]() {
+                return see && g->u.overmap_los( omp, sight_points );
+            };
+            const auto note = blink ? notes.find( omp.xy() ) : notes.end();
             if( blink && omp == orig ) {
                 // Display player pos, should always be visible
                 ter_color = g->u.symbol_color();
                 ter_sym = "@";
-            } else if( viewing_weather && ( data.debug_weather || los_sky ) ) {
+            } else if( viewing_weather && ( data.debug_weather ||
+                                            g->u.overmap_los( omp, sight_points * 2 ) ) ) {
                 const weather_type type = get_weather_at_point( omp );
                 ter_color = weather::map_color( type );
                 ter_sym = weather::glyph( type );
@@ -969,10 +1050,9 @@ void draw( const catacurses::window &w, const catacurses::window &wbar, const tr
                 } else if( target.z < center.z ) {
                     ter_sym = "v";
                 }
-            } else if( blink && uistate.overmap_show_map_notes && overmap_buffer.has_note( omp ) ) {
+            } else if( note != notes.end() ) {
                 // Display notes in all situations, even when not seen
-                std::tie( ter_sym, ter_color, std::ignore ) =
-                    get_note_display_info( overmap_buffer.note( omp ) );
+                std::tie( ter_sym, ter_color, std::ignore ) = get_note_display_info( *note->second );
             } else if( !see ) {
                 // All cases above ignore the seen-status,
                 ter_color = c_dark_gray;
@@ -982,13 +1062,13 @@ void draw( const catacurses::window &w, const catacurses::window &wbar, const tr
                 // Visible NPCs are cached already
                 ter_color = npc_color[ omp ].color;
                 ter_sym   = "@";
-            } else if( blink && mycount != 0 && g->debug_pathfinding ) {
+            } else if( blink && g->debug_pathfinding && path_route.count( omp ) != 0 ) {
                 ter_color = c_red;
                 ter_sym   = "!";
-            } else if( blink && player_path_count ) {
+            } else if( blink && player_path_route.count( omp ) != 0 ) {
                 ter_color = c_blue;
                 ter_sym = "!";
-            } else if( blink && showhordes && los &&
+            } else if( blink && showhordes && los() &&
                        overmap_buffer.get_horde_size( omp ) >= HORDE_VISIBILITY_SIZE ) {
                 // Display Hordes only when within player line-of-sight
                 ter_color = c_green;
@@ -1000,14 +1080,10 @@ void draw( const catacurses::window &w, const catacurses::window &wbar, const tr
             } else if( !sZoneName.empty() && tripointZone.xy() == omp.xy() ) {
                 ter_color = c_yellow;
                 ter_sym   = "Z";
-            } else if( !uistate.overmap_show_forest_trails && cur_ter &&
-                       is_ot_match( "forest_trail", cur_ter, ot_match_type::type ) ) {
-                // If forest trails shouldn't be displayed, and this is a forest trail, then
-                // instead render it like a forest.
-                set_color_and_symbol( forest, omp, ter_sym, ter_color );
             } else {
                 // Nothing special, but is visible to the player.
-                set_color_and_symbol( cur_ter, omp, ter_sym, ter_color );
+                ter_color = glyph.color;
+                ter_sym = glyphs->symbols[glyph.sym];
             }
 
             // Are we debugging monster groups?
@@ -1038,7 +1114,7 @@ void draw( const catacurses::window &w, const catacurses::window &wbar, const tr
                     }
                     // Set the color only if we encountered an eligible group.
                     if( ter_sym == "+" || ter_sym == "-" ) {
-                        if( los ) {
+                        if( los() ) {
                             ter_color = c_light_blue;
                         } else {
                             ter_color = c_blue;
@@ -1096,6 +1172,14 @@ void draw( const catacurses::window &w, const catacurses::window &wbar, const tr
         }
     }
 
+    for( auto it = terrain_glyph_cache.begin(); it != terrain_glyph_cache.end(); ) {
+        if( it->second.used ) {
+            ++it;
+        } else {
+            it = terrain_glyph_cache.erase( it );
+        }
+    }
+
     if( center.z == 0 && uistate.overmap_show_city_labels ) {
         draw_city_labels( w, center );
         draw_camp_labels( w, center );
@@ -1934,6 +2018,7 @@ static tripoint display( const tripoint &orig, const draw_data_t &data = draw_da
             last_blink = now;
         }
     } while( action != "QUIT" && action != "CONFIRM" );
+    terrain_glyph_cache.clear();
     return ret;
 }
 
@@ -3,9 +3,14 @@
 #include <algorithm>
 #include <cassert>
 #include <climits>
+#include <cmath>
+#include <cstdlib>
 #include <iterator>
 #include <list>
 #include <map>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "avatar.h"
 #include "basecamp.h"
@@ -16,6 +21,7 @@
 #include "common_types.h"
 #include "coordinate_conversions.h"
 #include "debug.h"
+#include "distribution_grid.h"
 #include "filesystem.h"
 #include "game.h"
 #include "game_constants.h"
@@ -23,6 +29,7 @@
 #include "line.h"
 #include "map.h"
 #include "memory_fast.h"
+#include "mission.h"
 #include "mongroup.h"
 #include "monster.h"
 #include "npc.h"
@@ -84,11 +91,16 @@ overmap &overmapbuffer::get( const point &p )
 
     const auto it = overmaps.find( p );
     if( it != overmaps.end() ) {
+        last_use[p] = ++use_clock;
         return *( last_requested_overmap = it->second.get() );
     }
 
     // That constructor loads an existing overmap or creates a new one.
     overmap &new_om = *( overmaps[ p ] = std::make_unique<overmap>( p ) );
+    last_use[p] = ++use_clock;
+    evicted.erase( p );
+    // It exists from now on, and stays on disk if unloaded
+    known_non_existing.erase( p );
     new_om.populate();
     // Note: fix_mongroups might load other overmaps, so overmaps.back() is not
     // necessarily the overmap at (x,y)
@@ -108,38 +120,38 @@ void overmapbuffer::create_custom_overmap( const point &p, overmap_special_batch
         }
     }
     overmap &new_om = *( overmaps[ p ] = std::make_unique<overmap>( p ) );
+    last_use[p] = ++use_clock;
+    evicted.erase( p );
+    known_non_existing.erase( p );
     new_om.populate( specials );
 }
 
 void overmapbuffer::fix_mongroups( overmap &new_overmap )
 {
-    for( auto it = new_overmap.zg.begin(); it != new_overmap.zg.end(); ) {
-        auto &mg = it->second;
+    new_overmap.zg.erase_if( [&]( mongroup & mg ) {
         // spawn related code simply sets population to 0 when they have been
         // transformed into spawn points on a submap, the group can then be removed
         if( mg.empty() ) {
-            new_overmap.zg.erase( it++ );
-            continue;
+            return true;
         }
         // Inside the bounds of the overmap?
         if( mg.pos.x >= 0 && mg.pos.y >= 0 && mg.pos.x < OMAPX * 2 && mg.pos.y < OMAPY * 2 ) {
-            ++it;
-            continue;
+            return false;
         }
         point smabs = mg.pos.xy() + om_to_sm_copy( new_overmap.pos() );
         point omp = sm_to_om_remain( smabs );
         if( !has( omp ) ) {
             // Don't generate new overmaps, as this can be called from the
             // overmap-generating code.
-            ++it;
-            continue;
+            return false;
         }
         overmap &om = get( omp );
-        mg.pos.x = smabs.x;
-        mg.pos.y = smabs.y;
-        om.add_mon_group( mg );
-        new_overmap.zg.erase( it++ );
-    }
+        mongroup moved( mg );
+        moved.pos.x = smabs.x;
+        moved.pos.y = smabs.y;
+        om.add_mon_group( moved );
+        return true;
+    } );
 }
 
 void overmapbuffer::fix_npcs( overmap &new_overmap )
@@ -203,8 +215,128 @@ void overmapbuffer::save()
 void overmapbuffer::clear()
 {
     overmaps.clear();
+    last_use.clear();
+    evicted.clear();
     known_non_existing.clear();
     last_requested_overmap = nullptr;
+    npc_path_cache.clear();
+}
+
+size_t overmapbuffer::overmap_bytes( const overmap &om )
+{
+    return sizeof( overmap ) + om.zg.size() * sizeof( mongroup ) + om.npcs.size() * sizeof( npc );
+}
+
+size_t overmapbuffer::resident_count() const
+{
+    return overmaps.size();
+}
+
+size_t overmapbuffer::resident_bytes() const
+{
+    size_t bytes = 0;
+    for( const auto &omp : overmaps ) {
+        bytes += overmap_bytes( *omp.second );
+    }
+    return bytes;
+}
+
+size_t overmapbuffer::evicted_count() const
+{
+    return evicted.size();
+}
+
+size_t overmapbuffer::evicted_bytes() const
+{
+    size_t bytes = 0;
+    for( const auto &elem : evicted ) {
+        bytes += elem.second;
+    }
+    return bytes;
+}
+
+std::set<point> overmapbuffer::overmaps_in_use()
+{
+    std::set<point> in_use;
+    // Everything within half an overmap of the player
+    const point player_omt = g->u.global_omt_location().xy();
+    const point min = omt_to_om_copy( player_omt - point( OMAPX / 2, OMAPY / 2 ) );
+    const point max = omt_to_om_copy( player_omt + point( OMAPX / 2, OMAPY / 2 ) );
+    for( int x = min.x; x <= max.x; x++ ) {
+        for( int y = min.y; y <= max.y; y++ ) {
+            in_use.insert( point( x, y ) );
+        }
+    }
+    for( const tripoint &camp : g->u.camps ) {
+        in_use.insert( omt_to_om_copy( camp.xy() ) );
+    }
+    for( const npc &guy : g->all_npcs() ) {
+        in_use.insert( omt_to_om_copy( guy.global_omt_location().xy() ) );
+    }
+    // Givers and targets of the missions of the player must stay findable by find_npc
+    std::set<character_id> mission_npcs;
+    for( const std::vector<mission *> &missions : {
+             g->u.get_active_missions(), g->u.get_completed_missions(), g->u.get_failed_missions()
+         } ) {
+        for( const mission *miss : missions ) {
+            mission_npcs.insert( miss->get_npc_id() );
+            mission_npcs.insert( miss->get_target_npc_id() );
+        }
+    }
+    // Unloading would drop the NPC objects, and reloading would create new ones
+    for( const auto &omp : overmaps ) {
+        for( const shared_ptr_fast<npc> &guy : omp.second->npcs ) {
+            if( guy->is_active() || guy->is_player_ally() || guy->is_travelling() ||
+                mission_npcs.count( guy->getID() ) > 0 ) {
+                in_use.insert( omp.first );
+                break;
+            }
+        }
+    }
+    for( const tripoint &sm_pos : get_distribution_grid_tracker().tracked_submaps() ) {
+        in_use.insert( sm_to_om_copy( sm_pos.xy() ) );
+    }
+    return in_use;
+}
+
+size_t overmapbuffer::unload_cold( size_t budget )
+{
+    size_t used = resident_bytes();
+    if( used <= budget ) {
+        return 0;
+    }
+
+    const std::set<point> in_use = overmaps_in_use();
+    // Least recently used first
+    std::vector<std::pair<uint64_t, point>> by_use;
+    for( const auto &omp : overmaps ) {
+        if( in_use.count( omp.first ) == 0 ) {
+            const auto iter = last_use.find( omp.first );
+            by_use.emplace_back( iter == last_use.end() ? 0 : iter->second, omp.first );
+        }
+    }
+    std::sort( by_use.begin(), by_use.end() );
+    if( !by_use.empty() ) {
+        last_requested_overmap = nullptr;
+    }
+
+    size_t num_unloaded = 0;
+    for( const std::pair<uint64_t, point> &cold : by_use ) {
+        if( used <= budget ) {
+            break;
+        }
+        const auto iter = overmaps.find( cold.second );
+        const size_t bytes = overmap_bytes( *iter->second );
+        // Note: this may throw io errors from std::ofstream
+        iter->second->save();
+        overmaps.erase( iter );
+        known_non_existing.erase( cold.second );
+        last_use.erase( cold.second );
+        evicted[cold.second] = bytes;
+        used -= std::min( used, bytes );
+        num_unloaded++;
+    }
+    return num_unloaded;
 }
 
 const regional_settings &overmapbuffer::get_settings( const tripoint &p )
@@ -256,6 +388,7 @@ overmap *overmapbuffer::get_existing( const point &p )
     }
     const auto it = overmaps.find( p );
     if( it != overmaps.end() ) {
+        last_use[p] = ++use_clock;
         return last_requested_overmap = it->second.get();
     }
     if( known_non_existing.count( p ) > 0 ) {
@@ -389,7 +522,7 @@ bool overmapbuffer::is_explored( const tripoint &p )
 void overmapbuffer::toggle_explored( const tripoint &p )
 {
     const overmap_with_local_coords om_loc = get_om_global( p );
-    om_loc.om->explored( om_loc.local ) = !om_loc.om->explored( om_loc.local );
+    om_loc.om->set_explored( om_loc.local, !om_loc.om->is_explored( om_loc.local ) );
 }
 
 bool overmapbuffer::has_horde( const tripoint &p )
@@ -517,13 +650,8 @@ std::vector<mongroup *> overmapbuffer::monsters_at( const tripoint &p )
 {
     // (x,y) are overmap terrain coordinates, they spawn 2x2 submaps,
     // but monster groups are defined with submap coordinates.
-    tripoint p_sm = omt_to_sm_copy( p );
-    std::vector<mongroup *> result;
-    for( const point &offset : std::array<point, 4> { { { point_zero }, { point_south }, { point_east }, { point_south_east } } } ) {
-        std::vector<mongroup *> tmp = groups_at( p_sm + offset );
-        result.insert( result.end(), tmp.begin(), tmp.end() );
-    }
-    return result;
+    const tripoint p_sm = omt_to_sm_copy( p );
+    return groups_in( p_sm, p_sm + point_south_east );
 }
 
 std::vector<mongroup *> overmapbuffer::groups_at( const tripoint &p )
@@ -535,13 +663,38 @@ std::vector<mongroup *> overmapbuffer::groups_at( const tripoint &p )
         return result;
     }
     overmap &om = get( omp );
-    auto groups_range = om.zg.equal_range( tripoint( sm_within_om, p.z ) );
-    for( auto it = groups_range.first; it != groups_range.second; ++it ) {
-        mongroup &mg = it->second;
-        if( mg.empty() ) {
-            continue;
+    om.zg.for_each_at( tripoint( sm_within_om, p.z ), [&]( mongroup & mg ) {
+        if( !mg.empty() ) {
+            result.push_back( &mg );
+        }
+    } );
+    return result;
+}
+
+std::vector<mongroup *> overmapbuffer::groups_in( const tripoint &min, const tripoint &max )
+{
+    std::vector<mongroup *> result;
+    const point om_min = sm_to_om_copy( min.xy() );
+    const point om_max = sm_to_om_copy( max.xy() );
+    for( int x = om_min.x; x <= om_max.x; ++x ) {
+        for( int y = om_min.y; y <= om_max.y; ++y ) {
+            const point omp( x, y );
+            if( !has( omp ) ) {
+                continue;
+            }
+            overmap &om = get( omp );
+            // Only the part of the box covered by this overmap, like groups_at
+            const tripoint origin( om_to_sm_copy( omp ), 0 );
+            const tripoint local_min( std::max( min.x - origin.x, 0 ), std::max( min.y - origin.y, 0 ),
+                                      min.z );
+            const tripoint local_max( std::min( max.x - origin.x, OMAPX * 2 - 1 ),
+                                      std::min( max.y - origin.y, OMAPY * 2 - 1 ), max.z );
+            om.zg.for_each_in( local_min, local_max, [&]( mongroup & mg ) {
+                if( !mg.empty() ) {
+                    result.push_back( &mg );
+                }
+            } );
         }
-        result.push_back( &mg );
     }
     return result;
 }
@@ -646,7 +799,7 @@ bool overmapbuffer::seen( const tripoint &p )
 void overmapbuffer::set_seen( const tripoint &p, bool seen )
 {
     const overmap_with_local_coords om_loc = get_om_global( p );
-    om_loc.om->seen( om_loc.local ) = seen;
+    om_loc.om->set_seen( om_loc.local, seen );
 }
 
 const oter_id &overmapbuffer::ter( const tripoint &p )
@@ -668,30 +821,41 @@ bool overmapbuffer::reveal( const point &center, int radius, int z )
 
 bool overmapbuffer::reveal( const tripoint &center, int radius )
 {
-    return reveal( center, radius, []( const oter_id & ) {
-        return true;
-    } );
+    return reveal( center, radius, nullptr );
 }
 
 bool overmapbuffer::reveal( const tripoint &center, int radius,
                             const std::function<bool( const oter_id & )> &filter )
 {
-    int radius_squared = radius * radius;
+    const int radius_squared = radius * radius;
     bool result = false;
-    for( int i = -radius; i <= radius; i++ ) {
-        for( int j = -radius; j <= radius; j++ ) {
-            const tripoint p = center + point( i, j );
-            if( seen( p ) ) {
-                continue;
+    for( int j = -radius; j <= radius; j++ ) {
+        int half_width = radius;
+        if( trigdist ) {
+            half_width = static_cast<int>( std::sqrt( radius_squared - j * j ) );
+            while( half_width * half_width + j * j > radius_squared ) {
+                half_width--;
             }
-            if( trigdist && i * i + j * j > radius_squared ) {
-                continue;
+            while( ( half_width + 1 ) * ( half_width + 1 ) + j * j <= radius_squared ) {
+                half_width++;
             }
-            if( !filter( ter( p ) ) ) {
-                continue;
+        }
+        const int x_last = center.x + half_width;
+        // Each overmap crossed by the row gets its part of the row in one go
+        for( int x = center.x - half_width; x <= x_last; ) {
+            const overmap_with_local_coords om_loc = get_om_global( tripoint( x, center.y + j, center.z ) );
+            const int x_end = std::min( OMAPX, om_loc.local.x + x_last - x + 1 );
+            if( !filter ) {
+                result |= om_loc.om->reveal_row( om_loc.local, x_end );
+            } else {
+                for( tripoint p = om_loc.local; p.x < x_end; p.x++ ) {
+                    if( !om_loc.om->seen( p ) && filter( om_loc.om->ter( p ) ) ) {
+                        om_loc.om->set_seen( p, true );
+                        result = true;
+                    }
+                }
             }
-            result = true;
-            set_seen( p, true );
+            x += x_end - om_loc.local.x;
         }
     }
     return result;
@@ -714,6 +878,22 @@ std::vector<tripoint> overmapbuffer::get_npc_path( const tripoint &src, const tr
         return path;
     }
 
+    // Paths that depend on what the player saw or marked can't be reused,
+    // others stay valid until some overmap terrain changes.
+    const bool cacheable = !ptype.only_known_by_player && !ptype.avoid_danger;
+    const std::tuple<tripoint, tripoint, int> cache_key( src, dest,
+            ptype.only_road | ptype.only_water << 1 | ptype.amphibious << 2 | ptype.only_air << 3 );
+    if( cacheable ) {
+        if( npc_path_cache_version != overmap::terrain_version() ) {
+            npc_path_cache.clear();
+            npc_path_cache_version = overmap::terrain_version();
+        }
+        const auto cached = npc_path_cache.find( cache_key );
+        if( cached != npc_path_cache.end() ) {
+            return cached->second;
+        }
+    }
+
     // Local source - center of the local area
     const point start( OX, OY );
     // To convert local coordinates to global ones
@@ -782,6 +962,15 @@ std::vector<tripoint> overmapbuffer::get_npc_path( const tripoint &src, const tr
         convert_result.z = base.z;
         path.push_back( convert_result );
     }
+    // Searching may have generated overmaps, which doesn't change the outcome
+    if( cacheable ) {
+        constexpr size_t max_cached_paths = 64;
+        if( npc_path_cache.size() >= max_cached_paths ) {
+            npc_path_cache.clear();
+        }
+        npc_path_cache_version = overmap::terrain_version();
+        npc_path_cache.emplace( cache_key, path );
+    }
     return path;
 }
 
@@ -963,6 +1152,98 @@ tripoint overmapbuffer::find_closest( const tripoint &origin, const std::string
     return find_closest( origin, params );
 }
 
+bool overmapbuffer::meets_find_filters( const overmap &om, const tripoint &local,
+                                        const omt_find_params &params ) const
+{
+    if( params.must_see && !om.seen( local ) ) {
+        return false;
+    }
+    if( params.cant_see && om.seen( local ) ) {
+        return false;
+    }
+    return !params.om_special || om.check_overmap_special_type( *params.om_special, local );
+}
+
+overmap *overmapbuffer::get_for_find( const point &p, const omt_find_params &params )
+{
+    if( params.existing_only ) {
+        return get_existing( p );
+    }
+    const size_t num_overmaps = overmaps.size();
+    overmap *om = &get( p );
+    if( params.popup && num_overmaps != overmaps.size() ) {
+        params.popup->refresh();
+    }
+    return om;
+}
+
+namespace
+{
+
+// Decides once per terrain whether it is one of the searched types
+class terrain_type_matcher
+{
+    public:
+        explicit terrain_type_matcher( const omt_find_params &params ) : params( params ) {}
+
+        bool operator()( const oter_id &ot ) {
+            const auto found = matches.find( ot );
+            if( found != matches.end() ) {
+                return found->second;
+            }
+            const bool result = std::any_of( params.types.begin(), params.types.end(),
+            [&ot]( const std::pair<std::string, ot_match_type> &type ) {
+                return is_ot_match( type.first, ot, type.second );
+            } );
+            matches.emplace( ot, result );
+            return result;
+        }
+
+    private:
+        const omt_find_params &params;
+        std::unordered_map<oter_id, bool> matches;
+};
+
+// Overmaps with any location within max_dist (square distance) of origin, nearest first,
+// each paired with the distance to its nearest location.
+std::vector<std::pair<int, point>> overmaps_in_range( const point &origin, int max_dist )
+{
+    const point lo = omt_to_om_copy( origin - point( max_dist, max_dist ) );
+    const point hi = omt_to_om_copy( origin + point( max_dist, max_dist ) );
+    std::vector<std::pair<int, point>> result;
+    for( int y = lo.y; y <= hi.y; ++y ) {
+        for( int x = lo.x; x <= hi.x; ++x ) {
+            const point base( x * OMAPX, y * OMAPY );
+            const int dx = std::max( { base.x - origin.x, origin.x - ( base.x + OMAPX - 1 ), 0 } );
+            const int dy = std::max( { base.y - origin.y, origin.y - ( base.y + OMAPY - 1 ), 0 } );
+            result.emplace_back( std::max( dx, dy ), point( x, y ) );
+        }
+    }
+    std::sort( result.begin(), result.end() );
+    return result;
+}
+
+// Visits the indexed locations of terrain list locs that lie on z-level z within
+// rows [y_min, y_max] of the overmap
+template<typename Visitor>
+void for_each_indexed_row( const std::vector<uint32_t> &locs, int z, int y_min, int y_max,
+                           Visitor &&visit )
+{
+    y_min = std::max( y_min, 0 );
+    y_max = std::min( y_max, OMAPY - 1 );
+    if( y_min > y_max ) {
+        return;
+    }
+    const uint32_t last = overmap::terrain_index_of( tripoint( OMAPX - 1, y_max, z ) );
+    for( auto it = std::lower_bound( locs.begin(), locs.end(),
+                                     overmap::terrain_index_of( tripoint( 0, y_min, z ) ) );
+         it != locs.end() && *it <= last; ++it ) {
+        visit( overmap::terrain_index_point( *it ) );
+    }
+}
+
+} // namespace
+
 tripoint overmapbuffer::find_closest( const tripoint &origin, const omt_find_params &params )
 {
     // Check the origin before searching adjacent tiles!
@@ -988,37 +1269,45 @@ tripoint overmapbuffer::find_closest( const tripoint &origin, const omt_find_par
     const int min_dist = params.min_distance;
     const int max_dist = params.search_range ? params.search_range : OMAPX * 5;
 
+    // Candidates come from the terrain index of each overmap rather than from
+    // checking every location in range
+    terrain_type_matcher matches( params );
     std::vector<tripoint> result;
-    cata::optional<int> found_dist;
-
-    size_t num_overmaps = overmaps.size();
-    size_t counter = 0;
-
-    for( const point &loc_xy : closest_points_first( origin.xy(), min_dist, max_dist ) ) {
-        const int dist_xy = square_dist( origin.xy(), loc_xy );
+    int found_dist = INT_MAX;
 
-        if( found_dist && *found_dist < dist_xy ) {
+    for( const std::pair<int, point> &om_in_range : overmaps_in_range( origin.xy(), max_dist ) ) {
+        if( om_in_range.first > found_dist ) {
             break;
         }
-
-        for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
-            const tripoint loc = { loc_xy, z };
-            const int dist = square_dist( origin, loc );
-
-            if( found_dist && *found_dist < dist ) {
+        overmap *om = get_for_find( om_in_range.second, params );
+        if( om == nullptr ) {
+            continue;
+        }
+        const tripoint base( om->global_base_point(), 0 );
+        for( const auto &terrain : om->terrain_locations() ) {
+            if( !matches( terrain.first ) ) {
                 continue;
             }
-
-            if( is_findable_location( loc, params ) ) {
-                found_dist = dist;
-                result.push_back( loc );
-            }
-
-            counter += 1;
-            if( params.popup && ( num_overmaps != overmaps.size() || counter == 512 ) ) {
-                params.popup->refresh();
-                num_overmaps = overmaps.size();
-                counter = 0;
+            for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+                const int limit = std::min( max_dist, found_dist );
+                if( std::abs( z - origin.z ) > limit ) {
+                    continue;
+                }
+                for_each_indexed_row( terrain.second, z, origin.y - base.y - limit,
+                origin.y - base.y + limit, [&]( const tripoint & local ) {
+                    const tripoint loc = base + local;
+                    const int dist_xy = square_dist( origin.xy(), loc.xy() );
+                    const int dist = square_dist( origin, loc );
+                    if( dist_xy < min_dist || dist_xy > max_dist || dist > found_dist ||
+                        !meets_find_filters( *om, local, params ) ) {
+                        return;
+                    }
+                    if( dist < found_dist ) {
+                        found_dist = dist;
+                        result.clear();
+                    }
+                    result.push_back( loc );
+                } );
             }
         }
     }
@@ -1033,23 +1322,37 @@ std::vector<tripoint> overmapbuffer::find_all( const tripoint &origin,
     // dist == 0 means search a whole overmap diameter.
     const int min_dist = params.min_distance;
     const int max_dist = params.search_range ? params.search_range : OMAPX;
+    if( min_dist > max_dist ) {
+        return result;
+    }
 
-    size_t num_overmaps = overmaps.size();
-    size_t counter = 0;
-
-    for( const tripoint &loc : closest_tripoints_first( origin, min_dist, max_dist ) ) {
-        if( is_findable_location( loc, params ) ) {
-            result.push_back( loc );
+    terrain_type_matcher matches( params );
+    for( const std::pair<int, point> &om_in_range : overmaps_in_range( origin.xy(), max_dist ) ) {
+        overmap *om = get_for_find( om_in_range.second, params );
+        if( om == nullptr ) {
+            continue;
         }
-
-        counter += 1;
-        if( params.popup && ( num_overmaps != overmaps.size() || counter == 512 ) ) {
-            params.popup->refresh();
-            num_overmaps = overmaps.size();
-            counter = 0;
+        const tripoint base( om->global_base_point(), 0 );
+        for( const auto &terrain : om->terrain_locations() ) {
+            if( !matches( terrain.first ) ) {
+                continue;
+            }
+            for_each_indexed_row( terrain.second, origin.z, origin.y - base.y - max_dist,
+            origin.y - base.y + max_dist, [&]( const tripoint & local ) {
+                const tripoint loc = base + local;
+                const int dist = square_dist( origin, loc );
+                if( dist >= min_dist && dist <= max_dist && meets_find_filters( *om, local, params ) ) {
+                    result.push_back( loc );
+                }
+            } );
         }
     }
 
+    // Nearest first, like the ring scan this replaced
+    std::stable_sort( result.begin(), result.end(), [&origin]( const tripoint & a,
+    const tripoint & b ) {
+        return square_dist( origin, a ) < square_dist( origin, b );
+    } );
     return result;
 }
 
@@ -3,10 +3,14 @@
 #define CATA_SRC_OVERMAPBUFFER_H
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <map>
 #include <memory>
 #include <set>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -156,6 +160,23 @@ class overmapbuffer
         overmap &get( const point & );
         void save();
         void clear();
+        /**
+         * Saves and unloads the least recently used overmaps until the loaded overmaps
+         * use at most @p budget bytes (see @ref resident_bytes).
+         * Overmaps near the player, and those holding the camps of the player, active,
+         * allied or travelling NPCs or a tracked distribution grid are never unloaded.
+         * Unloaded overmaps are loaded again by @ref get when needed.
+         * @return The number of unloaded overmaps.
+         */
+        size_t unload_cold( size_t budget );
+        /** Number of loaded overmaps. */
+        size_t resident_count() const;
+        /** Approximate memory used by the loaded overmaps, in bytes. */
+        size_t resident_bytes() const;
+        /** Number of overmaps unloaded by @ref unload_cold and not loaded since. */
+        size_t evicted_count() const;
+        /** Approximate memory the overmaps counted by @ref evicted_count used, in bytes. */
+        size_t evicted_bytes() const;
         void create_custom_overmap( const point &, overmap_special_batch &specials );
 
         /**
@@ -330,6 +351,8 @@ class overmapbuffer
          * A value of 0 makes only center visible, radius 1 makes a
          * square 3x3 visible.
          * @param z Z level to make area on
+         * @param filter Only terrain it accepts is revealed. Without one, whole
+         * rows of the area are marked at once.
          * @return true if something has actually been revealed.
          */
         bool reveal( const point &center, int radius, int z );
@@ -422,6 +445,11 @@ class overmapbuffer
          * Groups with no population are not included.
          */
         std::vector<mongroup *> groups_at( const tripoint &p );
+        /**
+         * Monster groups inside the box from min to max, inclusive, in absolute submap
+         * coordinates. Groups with no population are not included.
+         */
+        std::vector<mongroup *> groups_in( const tripoint &min, const tripoint &max );
 
         /**
          * Spawn monsters from the overmap onto the main map (game::m).
@@ -497,8 +525,24 @@ class overmapbuffer
          * see omt_find_params for definitions of the terms
          */
         bool is_findable_location( const tripoint &location, const omt_find_params &params );
+        /**
+         * Checks the criteria of @p params other than the terrain type, for a location
+         * given in coordinates local to @p om.
+         */
+        bool meets_find_filters( const overmap &om, const tripoint &local,
+                                 const omt_find_params &params ) const;
+        /**
+         * The overmap at @p p, generated if @p params allows it.
+         * Returns nullptr if it does not exist and may not be generated.
+         */
+        overmap *get_for_find( const point &p, const omt_find_params &params );
 
         std::unordered_map< point, std::unique_ptr< overmap > > overmaps;
+        /** Last use of each loaded overmap, larger is more recent. */
+        std::unordered_map<point, uint64_t> last_use;
+        uint64_t use_clock = 0;
+        /** Approximate size of the overmaps unloaded by @ref unload_cold. */
+        std::unordered_map<point, size_t> evicted;
         /**
          * Set of overmap coordinates of overmaps that are known
          * to not exist on disk. See @ref get_existing for usage.
@@ -506,6 +550,12 @@ class overmapbuffer
         mutable std::set<point> known_non_existing;
         // Cached result of previous call to overmapbuffer::get_existing
         overmap mutable *last_requested_overmap;
+        /**
+         * Paths found by @ref get_npc_path, keyed by source, destination and path type flags.
+         * Valid while @ref overmap::terrain_version stays at @ref npc_path_cache_version.
+         */
+        std::map<std::tuple<tripoint, tripoint, int>, std::vector<tripoint>> npc_path_cache;
+        uint64_t npc_path_cache_version = 0;
 
         /**
          * Get a list of notes in the (loaded) overmaps.
@@ -546,6 +596,10 @@ class overmapbuffer
          * Moves out-of-bounds NPCs to the overmaps they should be in.
          */
         void fix_npcs( overmap &new_overmap );
+        /** Approximate memory used by @p om, in bytes. */
+        static size_t overmap_bytes( const overmap &om );
+        /** Overmaps that must stay loaded, see @ref unload_cold. */
+        std::set<point> overmaps_in_use();
         /**
          * Retrieve overmaps that overlap the bounding box defined by the location and radius.
          * The location is in absolute submap coordinates, the radius is in the same system.
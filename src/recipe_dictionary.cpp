@@ -6,6 +6,7 @@
 #include <unordered_map>
 #include <utility>
 
+#include "calendar.h"
 #include "cata_algo.h"
 #include "cata_utility.h"
 #include "debug.h"
@@ -20,6 +21,7 @@
 #include "skill.h"
 #include "string_id.h"
 #include "string_utils.h"
+#include "translations.h"
 #include "uistate.h"
 #include "units.h"
 #include "value_ptr.h"
@@ -76,29 +78,95 @@ const recipe &recipe_dictionary::get_uncraft( const itype_id &id )
     return iter != recipe_dict.uncraft.end() ? iter->second : null_recipe;
 }
 
-// searches for left-anchored partial match in the relevant recipe requirements set
+namespace
+{
+
+/**
+ * Texts matched by @ref recipe_subset::search, for each recipe and search type.
+ * Building them looks up translated names and, for descriptions, creates the resulting
+ * item, so they are kept until the language changes or the recipes are reloaded.
+ * Descriptions may mention the player, so those are only kept for the current turn.
+ */
+struct recipe_search_cache {
+    std::map<std::pair<const recipe *, recipe_subset::search_type>, std::vector<std::string>> texts;
+    int language_version = INVALID_LANGUAGE_VERSION;
+    time_point descriptions_turn = calendar::before_time_starts;
+};
+
+recipe_search_cache &get_recipe_search_cache()
+{
+    static recipe_search_cache cache;
+    return cache;
+}
+
 template <class group>
-bool search_reqs( group gp, const std::string &txt )
+void add_requirement_texts( std::vector<std::string> &texts, const group &gp )
 {
-    return std::any_of( gp.begin(), gp.end(), [&]( const typename group::value_type & opts ) {
-        return std::any_of( opts.begin(),
-        opts.end(), [&]( const typename group::value_type::value_type & e ) {
-            return lcmatch( e.to_string(), txt );
-        } );
-    } );
+    for( const auto &opts : gp ) {
+        for( const auto &e : opts ) {
+            texts.push_back( e.to_string() );
+        }
+    }
 }
-// template specialization to make component searches easier
+
+// components are searched by their item names
 template<>
-bool search_reqs( std::vector<std::vector<item_comp> >  gp,
-                  const std::string &txt )
+void add_requirement_texts( std::vector<std::string> &texts,
+                            const std::vector<std::vector<item_comp>> &gp )
 {
-    return std::any_of( gp.begin(), gp.end(), [&]( const std::vector<item_comp> &opts ) {
-        return std::any_of( opts.begin(), opts.end(), [&]( const item_comp & ic ) {
-            return lcmatch( item::nname( ic.type ), txt );
-        } );
-    } );
+    for( const std::vector<item_comp> &opts : gp ) {
+        for( const item_comp &ic : opts ) {
+            texts.push_back( item::nname( ic.type ) );
+        }
+    }
+}
+
+std::vector<std::string> search_texts( const recipe &r, const recipe_subset::search_type key )
+{
+    using search_type = recipe_subset::search_type;
+    std::vector<std::string> texts;
+    switch( key ) {
+        case search_type::name:
+            texts.push_back( r.result_name() );
+            break;
+
+        case search_type::skill:
+            texts.push_back( r.required_skills_string( nullptr, true, false ) );
+            break;
+
+        case search_type::primary_skill:
+            texts.push_back( r.skill_used->name() );
+            break;
+
+        case search_type::component:
+            add_requirement_texts( texts, r.simple_requirements().get_components() );
+            break;
+
+        case search_type::tool:
+            add_requirement_texts( texts, r.simple_requirements().get_tools() );
+            break;
+
+        case search_type::quality:
+            add_requirement_texts( texts, r.simple_requirements().get_qualities() );
+            break;
+
+        case search_type::quality_result:
+            for( const std::pair<const quality_id, int> &e : item::find_type( r.result() )->qualities ) {
+                texts.push_back( e.first->name.translated() );
+            }
+            break;
+
+        case search_type::description_result: {
+            const item result = r.create_result();
+            texts.push_back( remove_color_tags( result.info( true ) ) );
+            break;
+        }
+    }
+    return texts;
 }
 
+} // namespace
+
 std::vector<const recipe *> recipe_subset::favorite() const
 {
     std::vector<const recipe *> res;
@@ -144,46 +212,36 @@ std::vector<const recipe *> recipe_subset::recent() const
 std::vector<const recipe *> recipe_subset::search( const std::string &txt,
         const search_type key ) const
 {
+    recipe_search_cache &cache = get_recipe_search_cache();
+    if( cache.language_version != detail::get_current_language_version() ) {
+        cache.texts.clear();
+        cache.language_version = detail::get_current_language_version();
+    }
+    if( key == search_type::description_result && cache.descriptions_turn != calendar::turn ) {
+        for( auto iter = cache.texts.begin(); iter != cache.texts.end(); ) {
+            if( iter->first.second == search_type::description_result ) {
+                iter = cache.texts.erase( iter );
+            } else {
+                ++iter;
+            }
+        }
+        cache.descriptions_turn = calendar::turn;
+    }
+
     std::vector<const recipe *> res;
 
     std::copy_if( recipes.begin(), recipes.end(), std::back_inserter( res ), [&]( const recipe * r ) {
         if( !*r || r->obsolete ) {
             return false;
         }
-        switch( key ) {
-            case search_type::name:
-                return lcmatch( r->result_name(), txt );
-
-            case search_type::skill:
-                return lcmatch( r->required_skills_string( nullptr, true, false ), txt );
-
-            case search_type::primary_skill:
-                return lcmatch( r->skill_used->name(), txt );
-
-            case search_type::component:
-                return search_reqs( r->simple_requirements().get_components(), txt );
-
-            case search_type::tool:
-                return search_reqs( r->simple_requirements().get_tools(), txt );
-
-            case search_type::quality:
-                return search_reqs( r->simple_requirements().get_qualities(), txt );
-
-            case search_type::quality_result: {
-                const auto &quals = item::find_type( r->result() )->qualities;
-                return std::any_of( quals.begin(), quals.end(), [&]( const std::pair<quality_id, int> &e ) {
-                    return lcmatch( e.first->name, txt );
-                } );
-            }
-
-            case search_type::description_result: {
-                const item result = r->create_result();
-                return lcmatch( remove_color_tags( result.info( true ) ), txt );
-            }
-
-            default:
-                return false;
+        const std::pair<const recipe *, search_type> cache_key( r, key );
+        auto iter = cache.texts.find( cache_key );
+        if( iter == cache.texts.end() ) {
+            iter = cache.texts.emplace( cache_key, search_texts( *r, key ) ).first;
         }
+        return std::any_of( iter->second.begin(), iter->second.end(), [&]( const std::string & text ) {
+            return lcmatch( text, txt );
+        } );
     } );
 
     return res;
@@ -469,6 +527,7 @@ void recipe_dictionary::finalize()
 
 void recipe_dictionary::reset()
 {
+    get_recipe_search_cache().texts.clear();
     deferred.clear();
     recipe_dict.blueprints.clear();
     recipe_dict.autolearn.clear();
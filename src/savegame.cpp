@@ -425,6 +425,8 @@ void overmap::unserialize( std::istream &fin, const std::string &file_path )
     while( !jsin.end_object() ) {
         const std::string name = jsin.get_member_name();
         if( name == "layers" ) {
+            terrain_index_built = false;
+            terrain_index.clear();
             std::unordered_map<tripoint, std::string> needs_conversion;
             jsin.start_array();
             for( int z = 0; z < OVERMAP_LAYERS; ++z ) {
@@ -683,21 +685,22 @@ void overmap::unserialize( std::istream &fin, const std::string &file_path )
     }
 }
 
-static void unserialize_array_from_compacted_sequence( JsonIn &jsin, bool ( &array )[OMAPX][OMAPY] )
+static void unserialize_array_from_compacted_sequence( JsonIn &jsin, om_bit_layer &bits )
 {
-    int count = 0;
-    bool value = false;
-    for( int j = 0; j < OMAPY; j++ ) {
-        for( auto &array_col : array ) {
-            if( count == 0 ) {
-                jsin.start_array();
-                jsin.read( value );
-                jsin.read( count );
-                jsin.end_array();
-            }
-            count--;
-            array_col[j] = value;
+    bits.reset();
+    int pos = 0;
+    while( pos < om_bit_layer::bit_count ) {
+        bool value = false;
+        int count = 0;
+        jsin.start_array();
+        jsin.read( value );
+        jsin.read( count );
+        jsin.end_array();
+        count = std::min( count, om_bit_layer::bit_count - pos );
+        if( value ) {
+            bits.set_range( pos, pos + count );
         }
+        pos += std::max( count, 1 );
     }
 }
 
@@ -763,30 +766,20 @@ void overmap::unserialize_view( std::istream &fin, const std::string &file_path
     }
 }
 
-static void serialize_array_to_compacted_sequence( JsonOut &json,
-        const bool ( &array )[OMAPX][OMAPY] )
+static void serialize_array_to_compacted_sequence( JsonOut &json, const om_bit_layer &bits )
 {
-    int count = 0;
-    int lastval = -1;
-    for( int j = 0; j < OMAPY; j++ ) {
-        for( const auto &array_col : array ) {
-            const int value = array_col[j];
-            if( value != lastval ) {
-                if( count ) {
-                    json.write( count );
-                    json.end_array();
-                }
-                lastval = value;
-                json.start_array();
-                json.write( static_cast<bool>( value ) );
-                count = 1;
-            } else {
-                count++;
-            }
-        }
+    bool value = bits.find_next( 0, true ) == 0;
+    int pos = 0;
+    while( pos < om_bit_layer::bit_count ) {
+        // Whole words of equal bits are skipped at once
+        const int next = bits.find_next( pos, !value );
+        json.start_array();
+        json.write( value );
+        json.write( next - pos );
+        json.end_array();
+        pos = next;
+        value = !value;
     }
-    json.write( count );
-    json.end_array();
 }
 
 void overmap::serialize_view( std::ostream &fout ) const
@@ -894,12 +887,12 @@ void overmap::save_monster_groups( JsonOut &jout ) const
     // Bin groups by their fields, except positions and monsters
     std::unordered_map<mongroup, std::list<tripoint>, mongroup_hash, mongroup_bin_eq> binned_groups;
     binned_groups.reserve( zg.size() );
-    for( const auto &pos_group : zg ) {
+    zg.for_each( [&]( const mongroup & group ) {
         // Each group in bin adds only position
         // so that 100 identical groups are 1 group data and 100 tripoints
-        std::list<tripoint> &positions = binned_groups[pos_group.second];
-        positions.emplace_back( pos_group.first );
-    }
+        std::list<tripoint> &positions = binned_groups[group];
+        positions.emplace_back( group.pos );
+    } );
 
     for( auto &group_bin : binned_groups ) {
         jout.start_array();
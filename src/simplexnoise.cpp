@@ -17,6 +17,7 @@
 
 #include "simplexnoise.h"
 
+#include <algorithm>
 #include <cmath>
 
 /* 2D, 3D and 4D Simplex Noise functions return 'random' values in (-1, 1).
@@ -141,6 +142,42 @@ float scaled_octave_noise_3d( const float octaves, const float persistence, cons
                             z ) * ( hiBound - loBound ) / 2 + ( hiBound + loBound ) / 2;
 }
 
+// 3D Scaled Multi-octave Simplex noise over a grid.
+//
+// Calls raw_noise_3d once per position and octave, just like scaled_octave_noise_3d,
+// and sums the octaves in the same order, so the values are identical. It is a
+// convenience for filling a grid, not a faster noise evaluation.
+void scaled_octave_noise_3d_grid( const float octaves, const float persistence, const float scale,
+                                  const float loBound, const float hiBound, const int x0, const int y0,
+                                  const int width, const int height, const float z, float *const out )
+{
+    const int count = width * height;
+    std::fill( out, out + count, 0.0f );
+
+    float frequency = scale;
+    float amplitude = 1;
+    float maxAmplitude = 0;
+
+    for( int i = 0; i < octaves; i++ ) {
+        const float zf = z * frequency;
+        for( int x = 0; x < width; x++ ) {
+            const float xf = static_cast<float>( x0 + x ) * frequency;
+            float *const column = out + x * height;
+            for( int y = 0; y < height; y++ ) {
+                column[y] += raw_noise_3d( xf, static_cast<float>( y0 + y ) * frequency, zf ) * amplitude;
+            }
+        }
+
+        frequency *= 2;
+        maxAmplitude += amplitude;
+        amplitude *= persistence;
+    }
+
+    for( int i = 0; i < count; i++ ) {
+        out[i] = out[i] / maxAmplitude * ( hiBound - loBound ) / 2 + ( hiBound + loBound ) / 2;
+    }
+}
+
 // 4D Scaled Multi-octave Simplex noise.
 //
 // Returned value will be between loBound and hiBound.
@@ -92,6 +92,21 @@ float scaled_octave_noise_4d( float octaves,
                               float z,
                               float w );
 
+// Scaled Multi-octave Simplex noise for a width by height grid of whole (x, y) positions
+// starting at (x0, y0), all at the same z. out[x * height + y] receives exactly what
+// scaled_octave_noise_3d returns for ( x0 + x, y0 + y, z ).
+void scaled_octave_noise_3d_grid( float octaves,
+                                  float persistence,
+                                  float scale,
+                                  float loBound,
+                                  float hiBound,
+                                  int x0,
+                                  int y0,
+                                  int width,
+                                  int height,
+                                  float z,
+                                  float *out );
+
 // Scaled Raw Simplex noise
 // The result will be between the two parameters passed.
 float scaled_raw_noise_2d( float loBound,
@@ -0,0 +1,174 @@
+#pragma once
+#ifndef CATA_SRC_SLOT_MAP_H
+#define CATA_SRC_SLOT_MAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace cata
+{
+
+/**
+ * Handle to an element of a @ref slot_map.
+ * Remains valid until the element is erased. After that it is recognized as stale,
+ * even if its slot has been reused for a different element.
+ */
+struct slot_map_handle {
+    static constexpr uint32_t invalid_index = UINT32_MAX;
+
+    uint32_t index = invalid_index;
+    uint32_t generation = 0;
+
+    bool is_null() const {
+        return index == invalid_index;
+    }
+    bool operator==( const slot_map_handle &rhs ) const {
+        return index == rhs.index && generation == rhs.generation;
+    }
+    bool operator!=( const slot_map_handle &rhs ) const {
+        return !( *this == rhs );
+    }
+};
+
+/**
+ * @brief Unordered container with stable handles and contiguous storage.
+ *
+ * Elements live in a dense vector, so iterating them is a linear scan.
+ * Insertion and erasure by handle are O(1); erasure moves the last element
+ * into the gap, so element order and dense indices are not stable, handles are.
+ */
+template<typename T>
+class slot_map
+{
+    public:
+        using handle = slot_map_handle;
+        using value_type = T;
+        using iterator = typename std::vector<T>::iterator;
+        using const_iterator = typename std::vector<T>::const_iterator;
+
+        handle insert( T value ) {
+            uint32_t slot_index;
+            if( free_slots.empty() ) {
+                slot_index = static_cast<uint32_t>( slots.size() );
+                slots.emplace_back();
+            } else {
+                slot_index = free_slots.back();
+                free_slots.pop_back();
+            }
+            slot &s = slots[slot_index];
+            s.dense_index = static_cast<uint32_t>( values.size() );
+            values.push_back( std::move( value ) );
+            dense_to_slot.push_back( slot_index );
+            return handle{ slot_index, s.generation };
+        }
+
+        /** Erases the element, returns false (and does nothing) if the handle is stale. */
+        bool erase( const handle &h ) {
+            if( !contains( h ) ) {
+                return false;
+            }
+            slot &s = slots[h.index];
+            const uint32_t gap = s.dense_index;
+            const uint32_t last = static_cast<uint32_t>( values.size() - 1 );
+            if( gap != last ) {
+                values[gap] = std::move( values[last] );
+                dense_to_slot[gap] = dense_to_slot[last];
+                slots[dense_to_slot[gap]].dense_index = gap;
+            }
+            values.pop_back();
+            dense_to_slot.pop_back();
+            ++s.generation;
+            free_slots.push_back( h.index );
+            return true;
+        }
+
+        bool contains( const handle &h ) const {
+            return h.index < slots.size() && slots[h.index].generation == h.generation;
+        }
+
+        /** Returns the element, or nullptr if the handle is stale. */
+        T *get( const handle &h ) {
+            return contains( h ) ? &values[slots[h.index].dense_index] : nullptr;
+        }
+        const T *get( const handle &h ) const {
+            return contains( h ) ? &values[slots[h.index].dense_index] : nullptr;
+        }
+
+        /** Dense index of the element, the handle must not be stale. */
+        size_t index_of( const handle &h ) const {
+            return slots[h.index].dense_index;
+        }
+
+        /** Swaps the elements at dense indices @p a and @p b, their handles stay valid. */
+        void swap_at( size_t a, size_t b ) {
+            using std::swap;
+            swap( values[a], values[b] );
+            swap( dense_to_slot[a], dense_to_slot[b] );
+            slots[dense_to_slot[a]].dense_index = static_cast<uint32_t>( a );
+            slots[dense_to_slot[b]].dense_index = static_cast<uint32_t>( b );
+        }
+
+        /** Handle of the element currently stored at dense index @p i. */
+        handle handle_at( size_t i ) const {
+            const uint32_t slot_index = dense_to_slot[i];
+            return handle{ slot_index, slots[slot_index].generation };
+        }
+
+        T &operator[]( size_t i ) {
+            return values[i];
+        }
+        const T &operator[]( size_t i ) const {
+            return values[i];
+        }
+
+        size_t size() const {
+            return values.size();
+        }
+        bool empty() const {
+            return values.empty();
+        }
+        void reserve( size_t n ) {
+            values.reserve( n );
+            dense_to_slot.reserve( n );
+            slots.reserve( n );
+        }
+        /** Erases all elements, outstanding handles become stale. */
+        void clear() {
+            for( const uint32_t slot_index : dense_to_slot ) {
+                ++slots[slot_index].generation;
+                free_slots.push_back( slot_index );
+            }
+            values.clear();
+            dense_to_slot.clear();
+        }
+
+        iterator begin() {
+            return values.begin();
+        }
+        iterator end() {
+            return values.end();
+        }
+        const_iterator begin() const {
+            return values.begin();
+        }
+        const_iterator end() const {
+            return values.end();
+        }
+
+    private:
+        struct slot {
+            uint32_t dense_index = 0;
+            uint32_t generation = 0;
+        };
+        std::vector<T> values;
+        /** Parallel to @ref values, the slot owning each element. */
+        std::vector<uint32_t> dense_to_slot;
+        std::vector<slot> slots;
+        std::vector<uint32_t> free_slots;
+};
+
+} // namespace cata
+
+#endif // CATA_SRC_SLOT_MAP_H
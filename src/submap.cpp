@@ -46,6 +46,7 @@ submap::submap()
     std::uninitialized_fill_n( &rad[0][0], elements, 0 );
 
     is_uniform = false;
+    mark_changed();
 }
 
 submap::submap( submap && ) = default;
@@ -53,6 +54,31 @@ submap::~submap() = default;
 
 submap &submap::operator=( submap && ) = default;
 
+bool submap::has_vehicle_obstacles() const
+{
+    if( !vehicle_obstacles ) {
+        vehicle_obstacles = false;
+        for( int x = 0; x < SEEX && !*vehicle_obstacles; x++ ) {
+            for( int y = 0; y < SEEY; y++ ) {
+                // Same as map::move_cost_ter_furn
+                const int tercost = ter[x][y].obj().movecost;
+                const int furncost = frn[x][y].obj().movecost;
+                if( tercost == 0 || furncost < 0 || tercost + furncost != 2 ) {
+                    vehicle_obstacles = true;
+                    break;
+                }
+            }
+        }
+    }
+    return *vehicle_obstacles;
+}
+
+void submap::mark_changed()
+{
+    static uint64_t change_counter = 0;
+    last_change = ++change_counter;
+}
+
 static const std::string COSMETICS_GRAFFITI( "GRAFFITI" );
 static const std::string COSMETICS_SIGNAGE( "SIGNAGE" );
 // Handle GCC warning: 'warning: returning reference to temporary'
@@ -234,6 +260,7 @@ void submap::rotate( int turns )
     if( turns == 0 ) {
         return;
     }
+    mark_changed();
 
     const auto rotate_point = [turns]( const point & p ) {
         return p.rotate( turns, { SEEX, SEEY } );
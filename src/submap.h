@@ -19,6 +19,7 @@
 #include "field.h"
 #include "game_constants.h"
 #include "item.h"
+#include "optional.h"
 #include "type_id.h"
 #include "point.h"
 #include "poly_serialized.h"
@@ -89,10 +90,12 @@ class submap : maptile_soa<SEEX, SEEY>
 
         void set_furn( const point &p, furn_id furn ) {
             is_uniform = false;
+            vehicle_obstacles.reset();
             frn[p.x][p.y] = furn;
         }
 
         void set_all_furn( const furn_id &furn ) {
+            vehicle_obstacles.reset();
             std::uninitialized_fill_n( &frn[0][0], elements, furn );
         }
 
@@ -102,13 +105,18 @@ class submap : maptile_soa<SEEX, SEEY>
 
         void set_ter( const point &p, ter_id terr ) {
             is_uniform = false;
+            vehicle_obstacles.reset();
             ter[p.x][p.y] = terr;
         }
 
         void set_all_ter( const ter_id &terr ) {
+            vehicle_obstacles.reset();
             std::uninitialized_fill_n( &ter[0][0], elements, terr );
         }
 
+        /** Whether the terrain and furniture of any tile here isn't flat ground (move cost 2). */
+        bool has_vehicle_obstacles() const;
+
         int get_radiation( const point &p ) const {
             return rad[p.x][p.y];
         }
@@ -232,6 +240,16 @@ class submap : maptile_soa<SEEX, SEEY>
         // Uniform submaps aren't saved/loaded, because regenerating them is faster
         bool is_uniform;
 
+        /**
+         * Stamp of the most recent change to the items, terrain, furniture or fields here.
+         * Stamps come from one global counter, so they are comparable across submaps.
+         */
+        uint64_t last_change = 0;
+        void mark_changed();
+
+        // Cached result of has_vehicle_obstacles, reset whenever terrain or furniture is set
+        mutable cata::optional<bool> vehicle_obstacles;
+
         std::vector<cosmetic_t> cosmetics; // Textual "visuals" for squares
 
         active_item_cache active_items;
@@ -104,6 +104,21 @@ static const std::unordered_map<std::string, vpart_bitflags> vpart_bitflag_map =
     { "RAIL", VPFLAG_RAIL },
     { "TURRET_CONTROLS", VPFLAG_TURRET_CONTROLS },
     { "ROOF", VPFLAG_ROOF },
+    { "E_ALTERNATOR", VPFLAG_E_ALTERNATOR },
+    { "WIND_POWERED", VPFLAG_WIND_POWERED },
+    { "FUNNEL", VPFLAG_FUNNEL },
+    { "UNMOUNT_ON_MOVE", VPFLAG_UNMOUNT_ON_MOVE },
+    { "EMITTER", VPFLAG_EMITTER },
+    { "STEERABLE", VPFLAG_STEERABLE },
+    { "TRACKED", VPFLAG_TRACKED },
+    { "SECURITY", VPFLAG_SECURITY },
+    { "EXTRA_DRAG", VPFLAG_EXTRA_DRAG },
+    { "CAMERA", VPFLAG_CAMERA },
+    { "TURRET", VPFLAG_TURRET },
+    { "PLANTER", VPFLAG_PLANTER },
+    { "STEREO", VPFLAG_STEREO },
+    { "CHIMES", VPFLAG_CHIMES },
+    { "CRASH_TERRAIN_AROUND", VPFLAG_CRASH_TERRAIN_AROUND },
 };
 
 static const std::vector<std::pair<std::string, veh_ter_mod>> standard_terrain_mod = {{
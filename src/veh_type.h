@@ -78,6 +78,21 @@ enum vpart_bitflags : int {
     VPFLAG_RAIL,
     VPFLAG_TURRET_CONTROLS,
     VPFLAG_ROOF,
+    VPFLAG_E_ALTERNATOR,
+    VPFLAG_WIND_POWERED,
+    VPFLAG_FUNNEL,
+    VPFLAG_UNMOUNT_ON_MOVE,
+    VPFLAG_EMITTER,
+    VPFLAG_STEERABLE,
+    VPFLAG_TRACKED,
+    VPFLAG_SECURITY,
+    VPFLAG_EXTRA_DRAG,
+    VPFLAG_CAMERA,
+    VPFLAG_TURRET,
+    VPFLAG_PLANTER,
+    VPFLAG_STEREO,
+    VPFLAG_CHIMES,
+    VPFLAG_CRASH_TERRAIN_AROUND,
 
     NUM_VPFLAGS
 };
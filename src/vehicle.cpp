@@ -2571,7 +2571,19 @@ int vehicle::part_with_feature( int part, vpart_bitflags const flag, bool unbrok
 
 int vehicle::part_with_feature( int part, const std::string &flag, bool unbroken ) const
 {
-    return part_with_feature( parts[part].mount, flag, unbroken );
+    if( part_flag( part, flag ) && ( !unbroken || !parts[part].is_broken() ) ) {
+        return part;
+    }
+    const auto it = relative_parts.find( parts[part].mount );
+    if( it != relative_parts.end() ) {
+        const std::vector<int> &parts_here = it->second;
+        for( auto &i : parts_here ) {
+            if( part_flag( i, flag ) && ( !unbroken || !parts[i].is_broken() ) ) {
+                return i;
+            }
+        }
+    }
+    return -1;
 }
 
 int vehicle::part_with_feature( const point &pt, const std::string &flag, bool unbroken ) const
@@ -2616,6 +2628,21 @@ bool vehicle::has_part( const std::string &flag, bool enabled ) const
     } );
 }
 
+bool vehicle::has_part( const vpart_bitflags flag, bool enabled ) const
+{
+    if( parts_by_flag.empty() ) {
+        // Not refreshed yet
+        return std::any_of( parts.begin(), parts.end(), [flag, enabled]( const vehicle_part & e ) {
+            return !e.removed && ( !enabled || e.enabled ) && !e.is_broken() && e.info().has_flag( flag );
+        } );
+    }
+    return std::any_of( parts_by_flag[flag].begin(), parts_by_flag[flag].end(),
+    [this, enabled]( const int p ) {
+        const vehicle_part &e = parts[p];
+        return !e.removed && ( !enabled || e.enabled ) && !e.is_broken();
+    } );
+}
+
 bool vehicle::has_part( const tripoint &pos, const std::string &flag, bool enabled ) const
 {
     const tripoint relative_pos = pos - global_pos3();
@@ -4541,8 +4568,17 @@ std::vector<vehicle_part *> vehicle::lights( bool active )
 int vehicle::total_accessory_epower_w() const
 {
     int epower = 0;
-    for( const vpart_reference &vp : get_enabled_parts( VPFLAG_ENABLED_DRAINS_EPOWER ) ) {
-        epower += vp.info().epower;
+    if( parts_by_flag.empty() ) {
+        for( const vpart_reference &vp : get_enabled_parts( VPFLAG_ENABLED_DRAINS_EPOWER ) ) {
+            epower += vp.info().epower;
+        }
+        return epower;
+    }
+    for( const int p : parts_by_flag[VPFLAG_ENABLED_DRAINS_EPOWER] ) {
+        const vehicle_part &vp = parts[p];
+        if( vp.enabled && !vp.removed && !vp.is_broken() ) {
+            epower += vp.info().epower;
+        }
     }
     return epower;
 }
@@ -4664,7 +4700,7 @@ void vehicle::update_alternator_load()
     if( engine_on ) {
         int engine_vpower = 0;
         for( size_t e = 0; e < engines.size(); ++e ) {
-            if( is_engine_on( e ) && parts[engines[e]].info().has_flag( "E_ALTERNATOR" ) ) {
+            if( is_engine_on( e ) && parts[engines[e]].info().has_flag( VPFLAG_E_ALTERNATOR ) ) {
                 engine_vpower += part_vpower_w( engines[e] );
             }
         }
@@ -4983,7 +5019,8 @@ int vehicle::charge_battery( int amount, bool include_other_vehicles )
 {
     // Key parts by percentage charge level.
     std::multimap<int, vehicle_part *> chargeable_parts;
-    for( vehicle_part &p : parts ) {
+    for( const int b : batteries ) {
+        vehicle_part &p = parts[b];
         if( p.is_available() && p.is_battery() && p.ammo_capacity() > p.ammo_remaining() ) {
             chargeable_parts.insert( { ( p.ammo_remaining() * 100 ) / p.ammo_capacity(), &p } );
         }
@@ -5028,7 +5065,8 @@ int vehicle::discharge_battery( int amount, bool recurse )
 {
     // Key parts by percentage charge level.
     std::multimap<int, vehicle_part *> dischargeable_parts;
-    for( vehicle_part &p : parts ) {
+    for( const int b : batteries ) {
+        vehicle_part &p = parts[b];
         if( p.is_available() && p.is_battery() && p.ammo_remaining() > 0 ) {
             dischargeable_parts.insert( { ( p.ammo_remaining() * 100 ) / p.ammo_capacity(), &p } );
         }
@@ -5110,7 +5148,7 @@ void vehicle::idle( bool on_map )
     }
 
     if( !warm_enough_to_plant( g->u.pos() ) ) {
-        for( const vpart_reference &vp : get_enabled_parts( "PLANTER" ) ) {
+        for( const vpart_reference &vp : get_enabled_parts( VPFLAG_PLANTER ) ) {
             if( g->u.sees( global_pos3() ) ) {
                 add_msg( _( "The %s's planter turns off due to low temperature." ), name );
             }
@@ -5126,15 +5164,15 @@ void vehicle::idle( bool on_map )
 
     process_emitters();
 
-    if( has_part( "STEREO", true ) ) {
+    if( has_part( VPFLAG_STEREO, true ) ) {
         play_music();
     }
 
-    if( has_part( "CHIMES", true ) ) {
+    if( has_part( VPFLAG_CHIMES, true ) ) {
         play_chimes();
     }
 
-    if( has_part( "CRASH_TERRAIN_AROUND", true ) ) {
+    if( has_part( VPFLAG_CRASH_TERRAIN_AROUND, true ) ) {
         crash_terrain_around();
     }
 
@@ -5548,6 +5586,8 @@ void vehicle::refresh()
     steering.clear();
     speciality.clear();
     floating.clear();
+    batteries.clear();
+    parts_by_flag.assign( NUM_VPFLAGS, std::vector<int>() );
     alternator_load = 0;
     extra_drag = 0;
     all_wheels_on_one_axis = true;
@@ -5595,9 +5635,17 @@ void vehicle::refresh()
                                          static_cast<int>( p ), svpv );
         relative_parts[pt].insert( vii, p );
 
+        for( int f = 0; f < NUM_VPFLAGS; f++ ) {
+            if( vpi.has_flag( static_cast<vpart_bitflags>( f ) ) ) {
+                parts_by_flag[f].push_back( p );
+            }
+        }
         if( vpi.has_flag( VPFLAG_FLOATS ) ) {
             floating.push_back( p );
         }
+        if( vp.part().is_battery() ) {
+            batteries.push_back( p );
+        }
 
         if( vp.part().is_unavailable() ) {
             continue;
@@ -5617,22 +5665,22 @@ void vehicle::refresh()
         if( vpi.has_flag( VPFLAG_ROTOR ) ) {
             rotors.push_back( p );
         }
-        if( vpi.has_flag( "WIND_TURBINE" ) ) {
+        if( vpi.has_flag( VPFLAG_WIND_TURBINE ) ) {
             wind_turbines.push_back( p );
         }
-        if( vpi.has_flag( "WIND_POWERED" ) ) {
+        if( vpi.has_flag( VPFLAG_WIND_POWERED ) ) {
             sails.push_back( p );
         }
-        if( vpi.has_flag( "WATER_WHEEL" ) ) {
+        if( vpi.has_flag( VPFLAG_WATER_WHEEL ) ) {
             water_wheels.push_back( p );
         }
-        if( vpi.has_flag( "FUNNEL" ) ) {
+        if( vpi.has_flag( VPFLAG_FUNNEL ) ) {
             funnels.push_back( p );
         }
-        if( vpi.has_flag( "UNMOUNT_ON_MOVE" ) ) {
+        if( vpi.has_flag( VPFLAG_UNMOUNT_ON_MOVE ) ) {
             loose_parts.push_back( p );
         }
-        if( vpi.has_flag( "EMITTER" ) ) {
+        if( vpi.has_flag( VPFLAG_EMITTER ) ) {
             emitters.push_back( p );
         }
         if( vpi.has_flag( VPFLAG_WHEEL ) ) {
@@ -5653,29 +5701,29 @@ void vehicle::refresh()
             railwheel_xmax = std::max( railwheel_xmax, pt.x );
             railwheel_ymax = std::max( railwheel_ymax, pt.y );
         }
-        if( ( vpi.has_flag( "STEERABLE" ) && part_with_feature( pt, "STEERABLE", true ) != -1 ) ||
-            vpi.has_flag( "TRACKED" ) ) {
+        if( ( vpi.has_flag( VPFLAG_STEERABLE ) && part_with_feature( pt, "STEERABLE", true ) != -1 ) ||
+            vpi.has_flag( VPFLAG_TRACKED ) ) {
             // TRACKED contributes to steering effectiveness but
             //  (a) doesn't count as a steering axle for install difficulty
             //  (b) still contributes to drag for the center of steering calculation
             steering.push_back( p );
         }
-        if( vpi.has_flag( "SECURITY" ) ) {
+        if( vpi.has_flag( VPFLAG_SECURITY ) ) {
             speciality.push_back( p );
         }
-        if( vp.part().enabled && vpi.has_flag( "EXTRA_DRAG" ) ) {
+        if( vp.part().enabled && vpi.has_flag( VPFLAG_EXTRA_DRAG ) ) {
             extra_drag += vpi.power;
         }
-        if( vpi.has_flag( "EXTRA_DRAG" ) && ( vpi.has_flag( "WIND_TURBINE" ) ||
-                                              vpi.has_flag( "WATER_WHEEL" ) ) ) {
+        if( vpi.has_flag( VPFLAG_EXTRA_DRAG ) && ( vpi.has_flag( VPFLAG_WIND_TURBINE ) ||
+                                              vpi.has_flag( VPFLAG_WATER_WHEEL ) ) ) {
             extra_drag += vpi.power;
         }
-        if( camera_on && vpi.has_flag( "CAMERA" ) ) {
+        if( camera_on && vpi.has_flag( VPFLAG_CAMERA ) ) {
             vp.part().enabled = true;
-        } else if( !camera_on && vpi.has_flag( "CAMERA" ) ) {
+        } else if( !camera_on && vpi.has_flag( VPFLAG_CAMERA ) ) {
             vp.part().enabled = false;
         }
-        if( vpi.has_flag( "TURRET" ) && !has_part( global_part_pos3( vp.part() ), "TURRET_CONTROLS" ) ) {
+        if( vpi.has_flag( VPFLAG_TURRET ) && !has_part( global_part_pos3( vp.part() ), "TURRET_CONTROLS" ) ) {
             vp.part().enabled = false;
         }
     }
@@ -6746,8 +6794,10 @@ void vehicle::update_time( const time_point &update_to )
     if( funnels.empty() && solar_panels.empty() && wind_turbines.empty() && water_wheels.empty() ) {
         return;
     }
-    // Get one weather data set per vehicle, they don't differ much across vehicle area
-    auto accum_weather = sum_conditions( update_from, update_to, g->m.getabs( global_pos3() ) );
+    // Get one weather data set per vehicle, they don't differ much across vehicle area.
+    // Whole hours are shared with the other vehicles on the same overmap terrain.
+    auto accum_weather = sum_hourly_conditions( update_from, update_to,
+                         g->m.getabs( global_pos3() ) );
     // make some reference objects to use to check for reload
     const item water( "water" );
     const item water_clean( "water_clean" );
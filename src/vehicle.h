@@ -988,6 +988,8 @@ class vehicle
          *  @returns true if part is found
          */
         bool has_part( const std::string &flag, bool enabled = false ) const;
+        /** @copydoc has_part(const std::string &, bool) const, only looks at the parts indexed by @ref refresh */
+        bool has_part( vpart_bitflags flag, bool enabled = false ) const;
 
         /**
          *  Check if vehicle has at least one unbroken part with specified flag
@@ -1754,6 +1756,9 @@ class vehicle
         // List of parts that will not be on a vehicle very often, or which only one will be present
         std::vector<int> speciality;
         std::vector<int> floating;         // List of parts that provide buoyancy to boats
+        std::vector<int> batteries;        // List of battery indices
+        // Indices of the parts with each vpart_bitflags flag, indexed by the flag
+        std::vector<std::vector<int>> parts_by_flag;
 
         // config values
         std::string name;   // vehicle name
@@ -1764,7 +1769,7 @@ class vehicle
          */
         vproto_id type;
         // parts_at_relative(dp) is used a lot (to put it mildly)
-        std::map<point, std::vector<int>> relative_parts;
+        std::unordered_map<point, std::vector<int>> relative_parts;
         std::set<label> labels;            // stores labels
         std::set<std::string> tags;        // Properties of the vehicle
         // After fuel consumption, this tracks the remainder of fuel < 1, and applies it the next time.
@@ -2,6 +2,7 @@
 
 #include <cassert>
 #include <algorithm>
+#include <climits>
 #include <array>
 #include <cmath>
 #include <cstdlib>
@@ -407,6 +408,19 @@ bool vehicle::collision( std::vector<veh_collision> &colls,
     const int velocity_before = coll_velocity;
     int lowest_velocity = coll_velocity;
     const int sign_before = sgn( velocity_before );
+    // Broad phase: if the area the vehicle moves into is flat ground, only creatures
+    // and other vehicles can be hit there, which is quick to look up per part.
+    bool flat_ground = false;
+    if( !vertical ) {
+        tripoint min( INT_MAX, INT_MAX, sm_pos.z );
+        tripoint max( INT_MIN, INT_MIN, sm_pos.z );
+        for( const vehicle_part &part : parts ) {
+            const tripoint dsp = global_pos3() + dp + part.precalc[1];
+            min = tripoint( std::min( min.x, dsp.x ), std::min( min.y, dsp.y ), dsp.z );
+            max = tripoint( std::max( max.x, dsp.x ), std::max( max.y, dsp.y ), dsp.z );
+        }
+        flat_ground = !parts.empty() && !g->m.has_vehicle_obstacles( min, max );
+    }
     bool empty = true;
     for( int p = 0; static_cast<size_t>( p ) < parts.size(); p++ ) {
         const vpart_info &info = part_info( p );
@@ -418,6 +432,12 @@ bool vehicle::collision( std::vector<veh_collision> &colls,
         // Coordinates of where part will go due to movement (dx/dy/dz)
         //  and turning (precalc[1])
         const tripoint dsp = global_pos3() + dp + parts[p].precalc[1];
+        if( flat_ground && info.rotor_diameter() == 0 && g->critter_at( dsp, true ) == nullptr ) {
+            const optional_vpart_position ovp = g->m.veh_at( dsp );
+            if( !ovp || &ovp->vehicle() == this ) {
+                continue;
+            }
+        }
         veh_collision coll = part_collision( p, dsp, just_detect, bash_floor );
         if( coll.type == veh_coll_nothing && info.rotor_diameter() > 0 ) {
             size_t radius = static_cast<size_t>( std::round( info.rotor_diameter() / 2.0f ) );
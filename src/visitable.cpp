@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <cstdint>
 #include <limits>
 #include <map>
 #include <memory>
@@ -167,14 +168,25 @@ bool visitable<T>::has_quality( const quality_id &qual, int level, int qty ) con
 template <>
 bool visitable<inventory>::has_quality( const quality_id &qual, int level, int qty ) const
 {
-    int res = 0;
-    for( const auto &stack : static_cast<const inventory *>( this )->items ) {
-        res += stack.size() * has_quality_internal( stack.front(), qual, level, qty );
-        if( res >= qty ) {
-            return true;
+    const inventory &self = *static_cast<const inventory *>( this );
+    if( self.items.empty() ) {
+        return false;
+    }
+    // Rebinning after a change also forgets the counted amounts
+    self.get_binned_items();
+
+    const std::pair<quality_id, int> key( qual, level );
+    auto iter = self.quality_amounts.find( key );
+    if( iter == self.quality_amounts.end() ) {
+        int res = 0;
+        for( const auto &stack : self.items ) {
+            const std::int64_t stack_qty = static_cast<std::int64_t>( stack.size() ) *
+                                           has_quality_internal( stack.front(), qual, level, INT_MAX );
+            res = sum_no_wrap( res, static_cast<int>( std::min<std::int64_t>( stack_qty, INT_MAX ) ) );
         }
+        iter = self.quality_amounts.emplace( key, res ).first;
     }
-    return false;
+    return iter->second >= qty;
 }
 
 /** @relates visitable */
@@ -676,6 +688,7 @@ std::list<item> visitable<map_cursor>::remove_items_with( const
     point offset;
     submap *sub = g->m.get_submap_at( *cur, offset );
     cata::colony<item> &stack = sub->get_items( offset );
+    sub->mark_changed();
 
     for( auto iter = stack.begin(); iter != stack.end(); ) {
         if( filter( *iter ) ) {
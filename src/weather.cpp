@@ -143,7 +143,7 @@ inline void proc_weather_sum( const weather_type wtype, weather_sum &data,
 
 weather_type current_weather( const tripoint &location, const time_point &t )
 {
-    const auto wgen = g->weather.get_cur_weather_gen();
+    const weather_generator &wgen = g->weather.get_cur_weather_gen();
     if( g->weather.weather_override != WEATHER_NULL ) {
         return g->weather.weather_override;
     }
@@ -169,11 +169,54 @@ weather_sum sum_conditions( const time_point &start, const time_point &end,
 
         weather_type wtype = current_weather( location, t );
         proc_weather_sum( wtype, data, t, tick_size );
-        data.wind_amount += get_local_windpower( g->weather.windspeed,
-                            overmap_buffer.ter( ms_to_omt_copy( location ) ),
-                            location,
-                            g->weather.winddirection, false ) * to_turns<int>( tick_size );
     }
+    // Wind only depends on the current wind and the surroundings, not on the time
+    if( start < end ) {
+        data.wind_amount = get_local_windpower( g->weather.windspeed,
+                                                overmap_buffer.ter( ms_to_omt_copy( location ) ),
+                                                location,
+                                                g->weather.winddirection, false ) * to_turns<int>( end - start );
+    }
+    return data;
+}
+
+weather_sum sum_hourly_conditions( const time_point &start, const time_point &end,
+                                   const tripoint &location )
+{
+    constexpr int hour_turns = to_turns<int>( 1_hours );
+    const int start_turn = to_turn<int>( start );
+    const int end_turn = to_turn<int>( end );
+    const int first_hour = ( start_turn + hour_turns - 1 ) / hour_turns * hour_turns;
+    const int last_hour = end_turn / hour_turns * hour_turns;
+    if( start_turn < 0 || first_hour >= last_hour ) {
+        return sum_conditions( start, end, location );
+    }
+
+    // The partial hours at both ends are summed as usual
+    weather_sum data = sum_conditions( start, time_point::from_turn( first_hour ), location );
+    const weather_sum tail = sum_conditions( time_point::from_turn( last_hour ), end, location );
+    data.rain_amount += tail.rain_amount;
+    data.acid_amount += tail.acid_amount;
+    data.sunlight += tail.sunlight;
+
+    const tripoint omt_origin( omt_to_ms_copy( ms_to_omt_copy( location.xy() ) ), location.z );
+    for( int hour = first_hour; hour < last_hour; hour += hour_turns ) {
+        const time_point t = time_point::from_turn( hour );
+        if( end - t > 7_days ) {
+            // Like sum_conditions, this far back the weather is only sampled once per hour
+            proc_weather_sum( current_weather( location, t ), data, t, 1_hours );
+            continue;
+        }
+        const weather_sum &hourly = g->weather.get_hourly_weather_sum( omt_origin, t );
+        data.rain_amount += hourly.rain_amount;
+        data.acid_amount += hourly.acid_amount;
+        data.sunlight += hourly.sunlight;
+    }
+
+    data.wind_amount = get_local_windpower( g->weather.windspeed,
+                                            overmap_buffer.ter( ms_to_omt_copy( location ) ),
+                                            location,
+                                            g->weather.winddirection, false ) * ( end_turn - start_turn );
     return data;
 }
 
@@ -633,7 +676,7 @@ std::string weather_forecast( const point &abs_sm_pos )
                                  1_hours;
     for( int d = 0; d < 6; d++ ) {
         weather_type forecast = WEATHER_NULL;
-        const auto wgen = g->weather.get_cur_weather_gen();
+        const weather_generator &wgen = g->weather.get_cur_weather_gen();
         for( time_point i = last_hour + d * 12_hours; i < last_hour + ( d + 1 ) * 12_hours; i += 1_hours ) {
             w_point w = wgen.get_weather( abs_ms_pos, i, g->get_seed() );
             forecast = std::max( forecast, wgen.get_weather_conditions( w ) );
@@ -1056,9 +1099,41 @@ int weather_manager::get_water_temperature( const tripoint & )
     return water_temperature;
 }
 
+double weather_manager::get_hourly_weather_temperature( const tripoint &location,
+        const time_point &hour )
+{
+    const std::pair<tripoint, time_point> key( location, hour );
+    const auto cached = hourly_temperature_cache.find( key );
+    if( cached != hourly_temperature_cache.end() ) {
+        return cached->second;
+    }
+    const double temp = get_cur_weather_gen().get_weather_temperature( location, hour,
+                        g->get_seed() );
+    hourly_temperature_cache.emplace( key, temp );
+    return temp;
+}
+
+const weather_sum &weather_manager::get_hourly_weather_sum( const tripoint &location,
+        const time_point &hour )
+{
+    const std::pair<tripoint, time_point> key( location, hour );
+    const auto cached = hourly_weather_sum_cache.find( key );
+    if( cached != hourly_weather_sum_cache.end() ) {
+        return cached->second;
+    }
+    weather_sum data;
+    // Same steps as sum_conditions uses within the last week
+    for( time_point t = hour; t < hour + 1_hours; t += 1_minutes ) {
+        proc_weather_sum( current_weather( location, t ), data, t, 1_minutes );
+    }
+    return hourly_weather_sum_cache.emplace( key, data ).first->second;
+}
+
 void weather_manager::clear_temp_cache()
 {
     temperature_cache.clear();
+    hourly_temperature_cache.clear();
+    hourly_weather_sum_cache.clear();
 }
 
 namespace weather
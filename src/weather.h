@@ -35,6 +35,7 @@ static constexpr int BODYTEMP_VERY_HOT = 8000;
 static constexpr int BODYTEMP_SCORCHING = 9500;
 ///@}
 
+#include <map>
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -204,6 +205,15 @@ double get_local_windpower( double windpower, const oter_id &omter, const tripoi
 weather_sum sum_conditions( const time_point &start,
                             const time_point &end,
                             const tripoint &location );
+/**
+ * Like @ref sum_conditions, but the whole hours of the last week of the span come from
+ * @ref weather_manager::get_hourly_weather_sum, so they are shared by everything on the
+ * same overmap terrain. The weather of those hours is the one at the corner of that
+ * overmap terrain instead of the one at @p location.
+ */
+weather_sum sum_hourly_conditions( const time_point &start,
+                                   const time_point &end,
+                                   const tripoint &location );
 
 /**
  * @param it The container item which is to be filled.
@@ -276,7 +286,22 @@ class weather_manager
         int get_temperature( const tripoint &location );
         // Returns water temperature of given location (in local coords) in Fahrenheit.
         int get_water_temperature( const tripoint &location );
+        /**
+         * Weather generator temperature of given location for the full hour @p hour in
+         * Fahrenheit, without local modifiers. Memoized until the next @ref clear_temp_cache,
+         * so items catching up on a long absence can share the lookups.
+         */
+        double get_hourly_weather_temperature( const tripoint &location, const time_point &hour );
+        /**
+         * Rain, acid and sunlight over the full hour @p hour at @p location (absolute
+         * map square), sampled every minute. Memoized until the next @ref clear_temp_cache.
+         */
+        const weather_sum &get_hourly_weather_sum( const tripoint &location, const time_point &hour );
         void clear_temp_cache();
+    private:
+        std::map<std::pair<tripoint, time_point>, weather_sum> hourly_weather_sum_cache;
+        /** sparse map of (map tripoint, full hour) to weather temperatures in Fahrenheit */
+        std::map<std::pair<tripoint, time_point>, double> hourly_temperature_cache;
 };
 
 weather_manager &get_weather();
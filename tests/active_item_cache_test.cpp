@@ -1,6 +1,8 @@
 #include <memory>
 #include <set>
+#include <vector>
 
+#include "active_item_cache.h"
 #include "calendar.h"
 #include "catch/catch.hpp"
 #include "game.h"
@@ -46,3 +48,113 @@ TEST_CASE( "place_active_item_at_various_coordinates", "[item]" )
         }
     }
 }
+
+TEST_CASE( "active_item_cache_processes_every_item_round_robin", "[item]" )
+{
+    // Food is processed every processing_speed() turns, a 1/speed slice per call.
+    std::vector<item> items( 1000, item( "meat_cooked" ) );
+    const size_t speed = items.front().processing_speed();
+    REQUIRE( speed > 1 );
+
+    active_item_cache cache;
+    for( item &it : items ) {
+        cache.add( it, point_zero );
+    }
+    // Adding twice does not duplicate the item
+    cache.add( items.front(), point_zero );
+    REQUIRE( cache.get().size() == items.size() );
+
+    std::set<const item *> processed;
+    for( size_t turn = 0; turn < speed; ++turn ) {
+        for( const item_reference &ref : cache.get_for_processing() ) {
+            processed.insert( ref.item_ref.get() );
+        }
+    }
+    CHECK( processed.size() == items.size() );
+
+    cache.remove( &items[10] );
+    CHECK( cache.get().size() == items.size() - 1 );
+    // Destroyed items are dropped the next time they are encountered
+    items.pop_back();
+    CHECK( cache.get().size() == items.size() - 1 );
+    for( item &it : items ) {
+        cache.remove( &it );
+    }
+    CHECK( cache.empty() );
+}
+
+TEST_CASE( "active_item_cache_round_robin_survives_removal", "[item]" )
+{
+    std::vector<item> items( 1000, item( "meat_cooked" ) );
+    const size_t speed = items.front().processing_speed();
+    REQUIRE( speed > 1 );
+
+    active_item_cache cache;
+    for( item &it : items ) {
+        cache.add( it, point_zero );
+    }
+
+    // Items returned in the current round, an item must not come again before the round ends
+    std::set<const item *> returned;
+    for( size_t turn = 0; turn < speed / 3; ++turn ) {
+        for( const item_reference &ref : cache.get_for_processing() ) {
+            REQUIRE( returned.insert( ref.item_ref.get() ).second );
+        }
+    }
+    REQUIRE( returned.size() < items.size() );
+
+    // Remove items on both sides of the round-robin position
+    std::set<const item *> remaining;
+    for( size_t i = 0; i < items.size(); ++i ) {
+        if( i % 7 == 0 ) {
+            cache.remove( &items[i] );
+            returned.erase( &items[i] );
+        } else {
+            remaining.insert( &items[i] );
+        }
+    }
+
+    // Every remaining item comes exactly once per round, and a round takes at most speed calls
+    int rounds = 0;
+    for( size_t turn = 0; turn < speed * 2; ++turn ) {
+        for( const item_reference &ref : cache.get_for_processing() ) {
+            const item *it = ref.item_ref.get();
+            CHECK( remaining.count( it ) == 1 );
+            if( returned.size() == remaining.size() ) {
+                returned.clear();
+                ++rounds;
+            }
+            CHECK( returned.insert( it ).second );
+        }
+        if( turn + 1 == speed ) {
+            CHECK( rounds >= 1 );
+        }
+    }
+    CHECK( rounds >= 2 );
+}
+
+// Benchmarks are skipped by default by using [.] tag
+TEST_CASE( "active_item_cache_benchmark", "[.][item][benchmark]" )
+{
+    std::vector<item> items( 100000, item( "firecracker_act", calendar::start_of_cataclysm,
+                             item::default_charges_tag() ) );
+
+    BENCHMARK( "add and remove 100k" ) {
+        active_item_cache cache;
+        for( item &it : items ) {
+            cache.add( it, point_zero );
+        }
+        for( item &it : items ) {
+            cache.remove( &it );
+        }
+        return cache.empty();
+    };
+
+    active_item_cache cache;
+    for( item &it : items ) {
+        cache.add( it, point_zero );
+    }
+    BENCHMARK( "get_for_processing 100k" ) {
+        return cache.get_for_processing().size();
+    };
+}
@@ -0,0 +1,104 @@
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "avatar.h"
+#include "catch/catch.hpp"
+#include "clzones.h"
+#include "game.h"
+#include "item.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "optional.h"
+#include "player_activity.h"
+#include "player_helpers.h"
+#include "point.h"
+#include "type_id.h"
+
+TEST_CASE( "zone_queries_follow_zone_bounds", "[zones]" )
+{
+    clear_map();
+    zone_manager::reset_manager();
+    zone_manager &mgr = zone_manager::get_manager();
+    const tripoint local_origin( 60, 60, 0 );
+    const tripoint origin = g->m.getabs( local_origin );
+    const zone_type_id loot_food( "LOOT_FOOD" );
+    mgr.add( "food", loot_food, faction_id( "your_followers" ), false, true,
+             origin + tripoint( 5, -2, 0 ), origin + tripoint( 7, 2, 0 ) );
+    mgr.cache_vzones();
+
+    CHECK( mgr.has( loot_food, origin + tripoint( 6, 0, 0 ) ) );
+    CHECK_FALSE( mgr.has( loot_food, origin + tripoint( 8, 0, 0 ) ) );
+
+    CHECK( mgr.has_near( loot_food, origin, 5 ) );
+    CHECK_FALSE( mgr.has_near( loot_food, origin, 4 ) );
+    CHECK_FALSE( mgr.has_near( loot_food, origin + tripoint_above, 10 ) );
+
+    const cata::optional<tripoint> nearest = mgr.get_nearest( loot_food, origin, 10 );
+    REQUIRE( nearest );
+    CHECK( *nearest == origin + tripoint( 5, 0, 0 ) );
+    CHECK_FALSE( mgr.get_nearest( loot_food, origin, 4 ) );
+
+    // Columns 5 and 6 of the zone, 5 tiles each
+    const std::unordered_set<tripoint> near_points = mgr.get_near( loot_food, origin, 6 );
+    CHECK( near_points.size() == 10 );
+    CHECK( near_points.count( origin + tripoint( 6, 2, 0 ) ) == 1 );
+    CHECK( near_points.count( origin + tripoint( 7, 2, 0 ) ) == 0 );
+    CHECK( mgr.get_near( loot_food, origin ).size() == 15 );
+
+    // Loot points are in local coordinates
+    const std::unordered_set<tripoint> loot_points = mgr.get_point_set_loot( origin, 6 );
+    CHECK( loot_points.size() == 10 );
+    CHECK( loot_points.count( local_origin + tripoint( 5, -2, 0 ) ) == 1 );
+
+    zone_manager::reset_manager();
+}
+
+static bool has_item_at( const tripoint &p, const itype_id &type )
+{
+    for( const item &it : g->m.i_at( p ) ) {
+        if( it.typeId() == type ) {
+            return true;
+        }
+    }
+    return false;
+}
+
+TEST_CASE( "sorting_loot_uses_the_nearest_matching_zone", "[zones][activity]" )
+{
+    clear_avatar();
+    clear_map();
+    zone_manager::reset_manager();
+    zone_manager &mgr = zone_manager::get_manager();
+    const faction_id fac( "your_followers" );
+    const tripoint src( 60, 60, 0 );
+    const tripoint near_tools = src + tripoint( 3, 0, 0 );
+    const tripoint far_tools = src + tripoint( 6, 0, 0 );
+    const tripoint clothing = src + tripoint( 0, 3, 0 );
+    g->u.setpos( src );
+    for( const std::pair<zone_type_id, tripoint> &zone : std::vector<std::pair<zone_type_id, tripoint>> {
+             { zone_type_id( "LOOT_UNSORTED" ), src },
+             { zone_type_id( "LOOT_TOOLS" ), far_tools },
+             { zone_type_id( "LOOT_TOOLS" ), near_tools },
+             { zone_type_id( "LOOT_CLOTHING" ), clothing },
+         } ) {
+        const tripoint abs_pos = g->m.getabs( zone.second );
+        mgr.add( "test", zone.first, fac, false, true, abs_pos, abs_pos );
+    }
+    g->m.add_item( src, item( "hammer" ) );
+    g->m.add_item( src, item( "hammer" ) );
+    g->m.add_item( src, item( "jeans" ) );
+
+    g->u.assign_activity( activity_id( "ACT_MOVE_LOOT" ) );
+    for( int turns = 0; g->u.activity && turns < 100; turns++ ) {
+        g->u.moves = 100;
+        g->u.activity.do_turn( g->u );
+    }
+
+    CHECK( g->m.i_at( src ).empty() );
+    CHECK( g->m.i_at( near_tools ).size() == 2 );
+    CHECK( g->m.i_at( far_tools ).empty() );
+    CHECK( has_item_at( clothing, itype_id( "jeans" ) ) );
+
+    zone_manager::reset_manager();
+}
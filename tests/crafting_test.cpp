@@ -16,10 +16,13 @@
 #include "crafting.h"
 #include "distribution_grid.h"
 #include "game.h"
+#include "iexamine.h"
 #include "item.h"
+#include "item_location.h"
 #include "itype.h"
 #include "map.h"
 #include "map_helpers.h"
+#include "map_selector.h"
 #include "npc.h"
 #include "overmap.h"
 #include "overmapbuffer.h"
@@ -119,6 +122,27 @@ TEST_CASE( "recipe_subset" )
     }
 }
 
+TEST_CASE( "recipe_subset_search", "[crafting][recipe]" )
+{
+    using search_type = recipe_subset::search_type;
+    const recipe *r = &recipe_id( "hammer" ).obj();
+    recipe_subset subset;
+    subset.include( r );
+
+    const auto found = []( const std::vector<const recipe *> &res, const recipe * rec ) {
+        return std::find( res.begin(), res.end(), rec ) != res.end();
+    };
+
+    CHECK( found( subset.search( "hammer" ), r ) );
+    // Repeated searches are answered from cached texts and must agree.
+    CHECK( subset.search( "hammer" ) == subset.search( "hammer" ) );
+    CHECK( found( subset.search( "stick", search_type::component ), r ) );
+    CHECK( found( subset.search( "tongs", search_type::tool ), r ) );
+    CHECK( found( subset.search( "fabrication", search_type::skill ), r ) );
+    CHECK( subset.search( "tongs", search_type::component ).empty() );
+    CHECK( subset.search( "no such recipe here" ).empty() );
+}
+
 TEST_CASE( "available_recipes", "[recipes]" )
 {
     const recipe *r = &recipe_id( "magazine_battery_light_mod" ).obj();
@@ -601,3 +625,78 @@ TEST_CASE( "oven electric grid test", "[crafting][overmap][grids][slow]" )
         }
     }
 }
+
+TEST_CASE( "crafting inventory follows changes to nearby items", "[crafting][inventory]" )
+{
+    clear_avatar();
+    clear_map();
+    const tripoint test_origin( 60, 60, 0 );
+    g->u.setpos( test_origin );
+    const tripoint next_to_player = test_origin + tripoint_east;
+
+    REQUIRE_FALSE( g->u.crafting_inventory().has_amount( itype_id( "rock" ), 1 ) );
+
+    calendar::turn += 1_turns;
+    REQUIRE_FALSE( g->u.crafting_inventory().has_amount( itype_id( "rock" ), 1 ) );
+
+    WHEN( "an item is dropped next to the player on a later turn" ) {
+        calendar::turn += 1_turns;
+        g->m.add_item( next_to_player, item( "rock" ) );
+        THEN( "it shows up without invalidating the crafting inventory" ) {
+            CHECK( g->u.crafting_inventory().has_amount( itype_id( "rock" ), 1 ) );
+        }
+        AND_WHEN( "it is removed again" ) {
+            calendar::turn += 1_turns;
+            REQUIRE( g->u.crafting_inventory().has_amount( itype_id( "rock" ), 1 ) );
+            g->m.i_clear( next_to_player );
+            THEN( "it is gone from the crafting inventory" ) {
+                CHECK_FALSE( g->u.crafting_inventory().has_amount( itype_id( "rock" ), 1 ) );
+            }
+        }
+    }
+
+    WHEN( "charges of a nearby item are used up" ) {
+        g->m.add_item( next_to_player, item( "thread", calendar::turn, 50 ) );
+        REQUIRE( g->u.crafting_inventory().has_charges( itype_id( "thread" ), 50 ) );
+        int quantity = 20;
+        g->m.use_charges( test_origin, PICKUP_RANGE, itype_id( "thread" ), quantity );
+        THEN( "the crafting inventory only has what remains" ) {
+            CHECK( g->u.crafting_inventory().has_charges( itype_id( "thread" ), 30 ) );
+            CHECK_FALSE( g->u.crafting_inventory().has_charges( itype_id( "thread" ), 31 ) );
+        }
+    }
+    WHEN( "charges are dropped onto an existing stack on a later turn" ) {
+        g->m.add_item( next_to_player, item( "thread", calendar::turn, 50 ) );
+        REQUIRE( g->u.crafting_inventory().has_charges( itype_id( "thread" ), 50 ) );
+        calendar::turn += 1_turns;
+        g->m.add_item_or_charges( next_to_player, item( "thread", calendar::turn, 20 ) );
+        REQUIRE( g->m.i_at( next_to_player ).size() == 1 );
+        THEN( "the crafting inventory has the merged stack" ) {
+            CHECK( g->u.crafting_inventory().has_charges( itype_id( "thread" ), 70 ) );
+        }
+    }
+
+    WHEN( "a nearby stack is changed in place through an item_location on a later turn" ) {
+        item &thread = g->m.add_item( next_to_player, item( "thread", calendar::turn, 50 ) );
+        REQUIRE( g->u.crafting_inventory().has_charges( itype_id( "thread" ), 50 ) );
+        calendar::turn += 1_turns;
+        item_location loc( map_cursor( next_to_player ), &thread );
+        loc->charges -= 20;
+        THEN( "the crafting inventory only has what remains" ) {
+            CHECK( g->u.crafting_inventory().has_charges( itype_id( "thread" ), 30 ) );
+            CHECK_FALSE( g->u.crafting_inventory().has_charges( itype_id( "thread" ), 31 ) );
+        }
+    }
+
+    WHEN( "liquid is poured into a keg that already holds some on a later turn" ) {
+        g->m.furn_set( next_to_player, furn_str_id( "f_standing_tank" ) );
+        g->m.add_item( next_to_player, item( "water_clean", calendar::turn, 10 ) );
+        REQUIRE( g->u.crafting_inventory().has_charges( itype_id( "water_clean" ), 10 ) );
+        calendar::turn += 1_turns;
+        item poured( "water_clean", calendar::turn, 5 );
+        REQUIRE( iexamine::pour_into_keg( next_to_player, poured ) );
+        THEN( "the crafting inventory has the filled keg" ) {
+            CHECK( g->u.crafting_inventory().has_charges( itype_id( "water_clean" ), 15 ) );
+        }
+    }
+}
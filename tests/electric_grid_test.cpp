@@ -149,3 +149,37 @@ TEST_CASE( "grid_and_vehicle_outside_bubble", "[grids][vehicle]" )
         test_grid_veh( setup.grid, setup.veh, setup.battery );
     }
 }
+
+TEST_CASE( "grid_totals_follow_battery_changes", "[grids]" )
+{
+    clear_map_and_put_player_underground();
+    auto setup = set_up_grid( g->m );
+    distribution_grid &grid = setup.grid;
+    battery_tile &battery = setup.battery;
+    REQUIRE( battery.get_resource() == 0 );
+
+    CHECK( grid.get_capacity() == battery.max_stored );
+    CHECK( grid.get_resource( false ) == 0 );
+
+    WHEN( "the battery is charged directly" ) {
+        REQUIRE( battery.mod_resource( 100 ) == 0 );
+        THEN( "the grid sees the charge" ) {
+            CHECK( grid.get_resource( false ) == 100 );
+        }
+        AND_WHEN( "the grid is discharged" ) {
+            CHECK( grid.mod_resource( -30, false ) == 0 );
+            THEN( "the charge is taken from the battery" ) {
+                CHECK( battery.get_resource() == 70 );
+                CHECK( grid.get_resource( false ) == 70 );
+            }
+        }
+        AND_WHEN( "the grid is overcharged" ) {
+            const int excess = grid.mod_resource( battery.max_stored, false );
+            THEN( "the battery is full and the rest is returned" ) {
+                CHECK( excess == 100 );
+                CHECK( battery.get_resource() == battery.max_stored );
+                CHECK( grid.get_resource( false ) == battery.max_stored );
+            }
+        }
+    }
+}
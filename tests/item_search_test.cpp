@@ -0,0 +1,28 @@
+#include <string>
+
+#include "catch/catch.hpp"
+#include "item.h"
+#include "item_search.h"
+
+TEST_CASE( "name_only_item_filters", "[item][search]" )
+{
+    CHECK( is_name_only_filter( "rifle" ) );
+    CHECK_FALSE( is_name_only_filter( "" ) );
+    CHECK_FALSE( is_name_only_filter( "c:food" ) );
+    CHECK_FALSE( is_name_only_filter( "-rifle" ) );
+    CHECK_FALSE( is_name_only_filter( "rifle,pistol" ) );
+}
+
+TEST_CASE( "refined_item_filters_narrow_the_previous_query", "[item][search]" )
+{
+    CHECK( filter_narrows( "ri", "rif" ) );
+    CHECK( filter_narrows( "if", "RIFL" ) );
+    CHECK_FALSE( filter_narrows( "rif", "ri" ) );
+    CHECK_FALSE( filter_narrows( "ri", "c:rif" ) );
+
+    // Whatever the narrower query matches, the broader one matches too
+    const item rock( "rock" );
+    REQUIRE( item_filter_from_string( "roc" )( rock ) );
+    CHECK( item_filter_from_string( "ro" )( rock ) );
+    CHECK_FALSE( item_filter_from_string( "rocx" )( rock ) );
+}
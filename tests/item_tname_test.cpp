@@ -303,3 +303,23 @@ TEST_CASE( "weapon fouling", "[item][tname][fouling][dirt]" )
         }
     }
 }
+
+TEST_CASE( "scoped tname cache", "[item][tname][cache]" )
+{
+    item towel( "towel" );
+    const std::string dry_name = towel.tname();
+
+    {
+        scoped_tname_cache cache;
+        CHECK( towel.tname() == dry_name );
+        CHECK( towel.tname( 2 ) == towel.tname_uncached( 2 ) );
+
+        // Modifications are not noticed while the cache is in scope
+        towel.set_flag( flag_WET );
+        CHECK( towel.tname() == dry_name );
+    }
+
+    // And are seen again once it is gone
+    CHECK( towel.tname() == towel.tname_uncached() );
+    CHECK( towel.tname() != dry_name );
+}
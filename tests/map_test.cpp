@@ -88,3 +88,24 @@ TEST_CASE( "place_player_can_safely_move_multiple_submaps" )
     g->place_player( tripoint_zero );
     CHECK( g->m.check_submap_active_item_consistency().empty() );
 }
+
+TEST_CASE( "vehicle_obstacle_summary_follows_terrain_changes", "[map][vehicle]" )
+{
+    clear_map();
+    const tripoint min( 48, 48, 0 );
+    const tripoint max( 59, 59, 0 );
+    REQUIRE( g->m.move_cost_ter_furn( min ) == 2 );
+    CHECK_FALSE( g->m.has_vehicle_obstacles( min, max ) );
+
+    g->m.ter_set( max, ter_id( "t_wall" ) );
+    CHECK( g->m.has_vehicle_obstacles( min, max ) );
+    // Answered per submap, so a neighbouring submap doesn't see it
+    CHECK_FALSE( g->m.has_vehicle_obstacles( max + tripoint( 1, 1, 0 ), max + tripoint( 5, 5, 0 ) ) );
+
+    g->m.ter_set( max, ter_id( "t_grass" ) );
+    CHECK_FALSE( g->m.has_vehicle_obstacles( min, max ) );
+    g->m.furn_set( min, furn_id( "f_chair" ) );
+    CHECK( g->m.has_vehicle_obstacles( min, max ) );
+
+    CHECK( g->m.has_vehicle_obstacles( tripoint( -1, 0, 0 ), max ) );
+}
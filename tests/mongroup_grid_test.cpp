@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <set>
+#include <vector>
+
+#include "catch/catch.hpp"
+#include "game_constants.h"
+#include "mongroup.h"
+#include "mongroup_grid.h"
+#include "point.h"
+#include "rng.h"
+#include "type_id.h"
+
+static const mongroup_id GROUP_ZOMBIE( "GROUP_ZOMBIE" );
+
+static std::multiset<tripoint> positions_in( mongroup_grid &grid, const tripoint &min,
+        const tripoint &max )
+{
+    std::multiset<tripoint> found;
+    grid.for_each_in( min, max, [&]( mongroup & mg ) {
+        found.insert( mg.pos );
+    } );
+    return found;
+}
+
+TEST_CASE( "mongroup_grid_queries_match_a_full_scan", "[monster][overmap]" )
+{
+    mongroup_grid grid;
+    std::vector<tripoint> positions;
+    rng_set_engine_seed( 4242 );
+    for( int i = 0; i < 500; ++i ) {
+        // Some of them off the overmap, like freshly spawned groups can be
+        const tripoint p( rng( -20, OMAPX * 2 + 20 ), rng( -20, OMAPY * 2 + 20 ), rng( -2, 2 ) );
+        positions.push_back( p );
+        grid.insert( mongroup( GROUP_ZOMBIE, p, 1, 1 ) );
+    }
+    REQUIRE( grid.size() == positions.size() );
+
+    for( int i = 0; i < 50; ++i ) {
+        const tripoint min( rng( -30, OMAPX * 2 ), rng( -30, OMAPY * 2 ), rng( -2, 1 ) );
+        const tripoint max = min + tripoint( rng( 0, 60 ), rng( 0, 60 ), rng( 0, 1 ) );
+        std::multiset<tripoint> expected;
+        for( const tripoint &p : positions ) {
+            if( p.x >= min.x && p.x <= max.x && p.y >= min.y && p.y <= max.y &&
+                p.z >= min.z && p.z <= max.z ) {
+                expected.insert( p );
+            }
+        }
+        CAPTURE( min, max );
+        CHECK( positions_in( grid, min, max ) == expected );
+    }
+
+    for( const tripoint &p : positions ) {
+        int found = 0;
+        grid.for_each_at( p, [&]( mongroup & mg ) {
+            CHECK( mg.pos == p );
+            found++;
+        } );
+        CHECK( found == std::count( positions.begin(), positions.end(), p ) );
+    }
+}
+
+TEST_CASE( "mongroup_grid_handles_survive_moves_and_erasure", "[monster][overmap]" )
+{
+    mongroup_grid grid;
+    const tripoint a_pos( 10, 10, 0 );
+    const tripoint b_pos( 11, 10, 0 );
+    const mongroup_grid::handle a = grid.insert( mongroup( GROUP_ZOMBIE, a_pos, 1, 5 ) );
+    const mongroup_grid::handle b = grid.insert( mongroup( GROUP_ZOMBIE, b_pos, 1, 0 ) );
+    mongroup *const b_group = grid.get( b );
+    REQUIRE( b_group != nullptr );
+
+    // Across a bucket border and off the overmap
+    const tripoint far_pos( mongroup_grid::bucket_size * 3 + 1, 10, 0 );
+    grid.move( a, far_pos );
+    CHECK( grid.get( a )->pos == far_pos );
+    CHECK( positions_in( grid, a_pos, a_pos ).empty() );
+    CHECK( positions_in( grid, far_pos, far_pos ).size() == 1 );
+    grid.move( a, tripoint( -1, 10, 0 ) );
+    CHECK( positions_in( grid, far_pos, far_pos ).empty() );
+    CHECK( positions_in( grid, tripoint( -1, 10, 0 ), tripoint( -1, 10, 0 ) ).size() == 1 );
+
+    // Erasing one group leaves the other where it was
+    grid.erase_if( []( mongroup & mg ) {
+        return mg.population == 5;
+    } );
+    CHECK( grid.get( a ) == nullptr );
+    CHECK( grid.get( b ) == b_group );
+    CHECK( grid.size() == 1 );
+    CHECK_FALSE( grid.erase( a ) );
+
+    const mongroup_grid copy( grid );
+    CHECK( copy.size() == 1 );
+    int copied = 0;
+    copy.for_each_at( b_pos, [&]( const mongroup & ) {
+        copied++;
+    } );
+    CHECK( copied == 1 );
+}
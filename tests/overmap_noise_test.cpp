@@ -1,10 +1,12 @@
 #include <fstream>
 #include <string>
+#include <vector>
 
 #include "catch/catch.hpp"
 #include "game_constants.h"
 #include "overmap_noise.h"
 #include "point.h"
+#include "simplexnoise.h"
 
 static void export_raw_noise( const std::string &filename, const om_noise::om_noise_layer &noise,
                               int width, int height )
@@ -67,3 +69,74 @@ TEST_CASE( "om_noise_layer_lake_export", "[.]" )
     export_raw_noise( "lake-map-raw.pgm", f, OMAPX * 5, OMAPY * 5 );
     export_interpreted_noise( "lake-map-interp.pgm", f, OMAPX * 5, OMAPY * 5, 0.25 );
 }
+
+template<typename Layer>
+static void check_grid_matches_layer( const point &base )
+{
+    const Layer layer( base, 1920237457 );
+    const om_noise::om_noise_grid<Layer> grid( base, 1920237457 );
+
+    for( int x = -2; x < OMAPX + 2; x++ ) {
+        for( int y = -2; y < OMAPY + 2; y++ ) {
+            const point p( x, y );
+            CAPTURE( p );
+            REQUIRE( grid.noise_at( p ) == layer.noise_at( p ) );
+        }
+    }
+}
+
+TEST_CASE( "om_noise_grid_matches_its_layer", "[overmap][noise]" )
+{
+    const point base( OMAPX * 3, -OMAPY );
+    SECTION( "lake" ) {
+        check_grid_matches_layer<om_noise::om_noise_layer_lake>( base );
+    }
+    SECTION( "forest" ) {
+        check_grid_matches_layer<om_noise::om_noise_layer_forest>( base );
+    }
+    SECTION( "floodplain" ) {
+        check_grid_matches_layer<om_noise::om_noise_layer_floodplain>( base );
+    }
+}
+
+TEST_CASE( "octave_noise_grid_matches_scalar_noise", "[noise]" )
+{
+    const int width = 37;
+    const int height = 23;
+    const point origin( -11, 5 );
+    const float z = 1234.5f;
+    std::vector<float> values( width * height );
+    scaled_octave_noise_3d_grid( 8, 0.5, 0.03, 0, 1, origin.x, origin.y, width, height, z,
+                                 values.data() );
+
+    for( int x = 0; x < width; x++ ) {
+        for( int y = 0; y < height; y++ ) {
+            const point p = origin + point( x, y );
+            CAPTURE( p );
+            REQUIRE( values[x * height + y] ==
+                     scaled_octave_noise_3d( 8, 0.5, 0.03, 0, 1, p.x, p.y, z ) );
+        }
+    }
+}
+
+// Benchmarks are skipped by default by using [.] tag
+TEST_CASE( "octave_noise_grid_benchmark", "[.][noise][benchmark]" )
+{
+    // Same parameters as the lake layer, which has the most octaves
+    const float z = 1920237457;
+    std::vector<float> values( OMAPX * OMAPY );
+
+    BENCHMARK( "scalar" ) {
+        for( int x = 0; x < OMAPX; x++ ) {
+            for( int y = 0; y < OMAPY; y++ ) {
+                values[x * OMAPY + y] = scaled_octave_noise_3d( 16, 0.5, 0.002, 0, 1, x, y, z );
+            }
+        }
+        return values.back();
+    };
+
+    BENCHMARK( "grid" ) {
+        scaled_octave_noise_3d_grid( 16, 0.5, 0.002, 0, 1, 0, 0, OMAPX, OMAPY, z, values.data() );
+        return values.back();
+    };
+}
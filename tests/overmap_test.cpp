@@ -1,17 +1,35 @@
 #include <algorithm>
+#include <chrono>
+#include <climits>
+#include <map>
 #include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
 #include <vector>
 
+#include "avatar.h"
+#include "cached_options.h"
 #include "calendar.h"
 #include "catch/catch.hpp"
 #include "common_types.h"
+#include "coordinate_conversions.h"
 #include "enums.h"
+#include "game.h"
 #include "game_constants.h"
+#include "line.h"
+#include "memory_fast.h"
+#include "mission.h"
+#include "npc.h"
 #include "omdata.h"
 #include "overmap.h"
+#include "overmap_location.h"
 #include "overmap_types.h"
 #include "overmapbuffer.h"
 #include "point.h"
+#include "rng.h"
+#include "string_formatter.h"
 #include "type_id.h"
 
 TEST_CASE( "set_and_get_overmap_scents" )
@@ -208,3 +226,291 @@ TEST_CASE( "is_ot_match", "[overmap][terrain]" )
         CHECK_FALSE( is_ot_match( "forestry", oter_id( "forest" ), ot_match_type::contains ) );
     }
 }
+
+TEST_CASE( "overmap_terrain_index_matches_full_scan", "[overmap][terrain]" )
+{
+    const tripoint origin( 90, 90, 0 );
+    const int radius = 10;
+    const oter_id lot( "s_lot" );
+    const tripoint near_spot = origin + tripoint( 3, -2, 0 );
+    const tripoint far_spot = origin + tripoint( -7, 5, -1 );
+
+    // What a location by location scan would find
+    const auto scan_all = [&]() {
+        std::set<tripoint> found;
+        for( const tripoint &p : closest_tripoints_first( origin, radius ) ) {
+            if( is_ot_match( "s_lot", overmap_buffer.ter( p ), ot_match_type::exact ) ) {
+                found.insert( p );
+            }
+        }
+        return found;
+    };
+    const auto scan_closest = [&]() {
+        int best = INT_MAX;
+        for( const tripoint &p : closest_tripoints_first( origin, radius ) ) {
+            for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; ++z ) {
+                const tripoint loc( p.xy(), z );
+                if( is_ot_match( "s_lot", overmap_buffer.ter( loc ), ot_match_type::exact ) ) {
+                    best = std::min( best, square_dist( origin, loc ) );
+                }
+            }
+        }
+        return best;
+    };
+    const auto check_index = [&]() {
+        const std::vector<tripoint> all = overmap_buffer.find_all( origin, "s_lot", radius, false,
+                                          ot_match_type::exact, true );
+        CHECK( std::set<tripoint>( all.begin(), all.end() ) == scan_all() );
+        const tripoint closest = overmap_buffer.find_closest( origin, "s_lot", radius, false,
+                                 ot_match_type::exact, true );
+        const int expected = scan_closest();
+        if( expected == INT_MAX ) {
+            CHECK( closest == overmap::invalid_tripoint );
+        } else {
+            CHECK( square_dist( origin, closest ) == expected );
+        }
+    };
+
+    const oter_id near_old = overmap_buffer.ter( near_spot );
+    const oter_id far_old = overmap_buffer.ter( far_spot );
+    check_index();
+
+    overmap_buffer.ter_set( far_spot, lot );
+    check_index();
+    overmap_buffer.ter_set( near_spot, lot );
+    check_index();
+    CHECK( square_dist( origin, overmap_buffer.find_closest( origin, "s_lot", radius, false,
+                        ot_match_type::exact, true ) ) <= square_dist( origin, near_spot ) );
+
+    overmap_buffer.ter_set( near_spot, near_old );
+    overmap_buffer.ter_set( far_spot, far_old );
+    check_index();
+}
+
+TEST_CASE( "npc_paths_follow_terrain_changes", "[overmap][npc]" )
+{
+    const tripoint src( 90, 90, 0 );
+    const tripoint dest( 96, 92, 0 );
+    // Open ground all around, whatever the test world put there
+    std::map<tripoint, oter_id> old_terrain;
+    for( const tripoint &p : closest_tripoints_first( tripoint( 93, 91, 0 ), 6 ) ) {
+        old_terrain.emplace( p, overmap_buffer.ter( p ) );
+        overmap_buffer.ter_set( p, oter_id( "field" ) );
+    }
+
+    const std::vector<tripoint> first = overmap_buffer.get_npc_path( src, dest );
+    REQUIRE( first.size() > 2 );
+    CHECK( overmap_buffer.get_npc_path( src, dest ) == first );
+
+    // Blocking a step of the path must force a different path
+    const tripoint blocked = first[first.size() / 2];
+    overmap_buffer.ter_set( blocked, oter_id( "empty_rock" ) );
+    const std::vector<tripoint> detour = overmap_buffer.get_npc_path( src, dest );
+    CHECK( std::find( detour.begin(), detour.end(), blocked ) == detour.end() );
+
+    overmap_buffer.ter_set( blocked, oter_id( "field" ) );
+    CHECK( overmap_buffer.get_npc_path( src, dest ) == first );
+
+    for( const std::pair<const tripoint, oter_id> &old : old_terrain ) {
+        overmap_buffer.ter_set( old.first, old.second );
+    }
+}
+
+TEST_CASE( "overmap_locations_match_their_terrain_types", "[overmap][terrain]" )
+{
+    std::set<string_id<overmap_location>> locations;
+    for( const overmap_special &special : overmap_specials::get_all() ) {
+        for( const overmap_special_terrain &terrain : special.terrains ) {
+            locations.insert( terrain.locations.begin(), terrain.locations.end() );
+        }
+    }
+    REQUIRE( !locations.empty() );
+
+    for( const string_id<overmap_location> &loc : locations ) {
+        const std::vector<oter_type_id> types = loc->get_all_terrains();
+        for( const oter_t &ter : overmap_terrains::get_all() ) {
+            const bool expected = std::any_of( types.begin(), types.end(),
+            [&]( const oter_type_id & type ) {
+                return ter.type_is( type );
+            } );
+            CAPTURE( loc.str(), ter.id.str() );
+            REQUIRE( loc->test( ter.id.id() ) == expected );
+        }
+    }
+}
+
+TEST_CASE( "om_bit_layer_ranges_match_single_bits", "[overmap]" )
+{
+    om_bit_layer bits;
+    std::vector<bool> expected( om_bit_layer::bit_count, false );
+    rng_set_engine_seed( 1234 );
+    for( int i = 0; i < 200; ++i ) {
+        const int begin = rng( 0, om_bit_layer::bit_count - 1 );
+        const int end = std::min( begin + rng( 0, 300 ), om_bit_layer::bit_count );
+        const bool was_full = std::all_of( expected.begin() + begin, expected.begin() + end,
+        []( bool b ) {
+            return b;
+        } );
+        CHECK( bits.set_range( begin, end ) == !was_full );
+        std::fill( expected.begin() + begin, expected.begin() + end, true );
+    }
+    for( int y = 0; y < OMAPY; ++y ) {
+        for( int x = 0; x < OMAPX; ++x ) {
+            REQUIRE( bits.test( point( x, y ) ) == expected[y * OMAPX + x] );
+        }
+    }
+    for( int from = 0; from < om_bit_layer::bit_count; from += 7 ) {
+        for( const bool value : {
+                 true, false
+             } ) {
+            const auto it = std::find( expected.begin() + from, expected.end(), value );
+            REQUIRE( bits.find_next( from, value ) == it - expected.begin() );
+        }
+    }
+}
+
+TEST_CASE( "overmap_view_survives_save_and_load", "[overmap]" )
+{
+    std::unique_ptr<overmap> saved = std::make_unique<overmap>( point_zero );
+    saved->reveal_row( { 3, 7, 0 }, 150 );
+    saved->reveal_row( { 0, OMAPY - 1, -OVERMAP_DEPTH }, OMAPX );
+    saved->set_seen( { 64, 64, 2 }, true );
+    saved->set_explored( { OMAPX - 1, 0, 0 }, true );
+    saved->set_explored( { 5, 5, -1 }, true );
+
+    std::ostringstream out;
+    saved->serialize_view( out );
+    std::istringstream in( out.str() );
+    std::unique_ptr<overmap> loaded = std::make_unique<overmap>( point_zero );
+    loaded->unserialize_view( in, "test" );
+
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; ++z ) {
+        for( int y = 0; y < OMAPY; ++y ) {
+            for( int x = 0; x < OMAPX; ++x ) {
+                const tripoint p( x, y, z );
+                REQUIRE( loaded->seen( p ) == saved->seen( p ) );
+                REQUIRE( loaded->is_explored( p ) == saved->is_explored( p ) );
+            }
+        }
+    }
+    CHECK( loaded->seen( { 3, 7, 0 } ) );
+    CHECK( !loaded->seen( { 150, 7, 0 } ) );
+}
+
+TEST_CASE( "overmap_reveal_marks_exactly_its_area", "[overmap]" )
+{
+    // Straddles the corner of four overmaps
+    const tripoint center( OMAPX * 7 - 2, OMAPY * 3 + 1, 1 );
+    const int radius = 6;
+    const auto inside = [&]( const point & d ) {
+        return std::abs( d.x ) <= radius && std::abs( d.y ) <= radius &&
+               ( !trigdist || d.x * d.x + d.y * d.y <= radius * radius );
+    };
+    std::map<tripoint, bool> outside_before;
+    for( int dx = -radius - 1; dx <= radius + 1; ++dx ) {
+        for( int dy = -radius - 1; dy <= radius + 1; ++dy ) {
+            if( !inside( point( dx, dy ) ) ) {
+                const tripoint p = center + point( dx, dy );
+                outside_before.emplace( p, overmap_buffer.seen( p ) );
+            }
+        }
+    }
+
+    overmap_buffer.reveal( center, radius );
+    for( int dx = -radius; dx <= radius; ++dx ) {
+        for( int dy = -radius; dy <= radius; ++dy ) {
+            if( inside( point( dx, dy ) ) ) {
+                CHECK( overmap_buffer.seen( center + point( dx, dy ) ) );
+            }
+        }
+    }
+    for( const std::pair<const tripoint, bool> &before : outside_before ) {
+        CHECK( overmap_buffer.seen( before.first ) == before.second );
+    }
+    CHECK_FALSE( overmap_buffer.reveal( center, radius ) );
+}
+
+TEST_CASE( "cold_overmaps_are_unloaded_and_loaded_again", "[overmap]" )
+{
+    const point far_om( -37, 41 );
+    const tripoint far_omt( om_to_omt_copy( far_om ) + point( 20, 30 ), 0 );
+    // Probed before it exists, like the edge of the overmap screen does
+    REQUIRE( overmap_buffer.get_existing( far_om ) == nullptr );
+    const oter_id far_ter = overmap_buffer.ter( far_omt );
+    overmap_buffer.add_note( far_omt, "unload me" );
+    overmap_buffer.set_seen( far_omt );
+    overmap *const near_om = &overmap_buffer.get( omt_to_om_copy(
+                                 g->u.global_omt_location().xy() ) );
+    const size_t resident_before = overmap_buffer.resident_count();
+    const size_t evicted_before = overmap_buffer.evicted_count();
+
+    REQUIRE( overmap_buffer.unload_cold( 0 ) > 0 );
+    CHECK( overmap_buffer.resident_count() < resident_before );
+    CHECK( overmap_buffer.evicted_count() > evicted_before );
+    CHECK( overmap_buffer.evicted_bytes() > 0 );
+    CHECK( overmap_buffer.resident_bytes() > 0 );
+    // Nothing left to unload
+    CHECK( overmap_buffer.unload_cold( 0 ) == 0 );
+
+    const size_t evicted_after = overmap_buffer.evicted_count();
+    // Without creating it
+    CHECK( overmap_buffer.get_existing( far_om ) != nullptr );
+    CHECK( overmap_buffer.seen( far_omt ) );
+    CHECK( overmap_buffer.ter( far_omt ) == far_ter );
+    CHECK( overmap_buffer.note( far_omt ) == "unload me" );
+    CHECK( overmap_buffer.evicted_count() < evicted_after );
+    CHECK( &overmap_buffer.get( omt_to_om_copy( g->u.global_omt_location().xy() ) ) == near_om );
+    overmap_buffer.delete_note( far_omt );
+}
+
+TEST_CASE( "overmaps_with_mission_npcs_stay_loaded", "[overmap][npc]" )
+{
+    const tripoint far_omt( om_to_omt_copy( point( 43, -39 ) ) + point( 50, 60 ), 0 );
+    shared_ptr_fast<npc> giver = make_shared_fast<npc>();
+    giver->normalize();
+    giver->randomize();
+    giver->spawn_at_sm( omt_to_sm_copy( far_omt ) );
+    overmap_buffer.insert_npc( giver );
+    REQUIRE_FALSE( giver->is_player_ally() );
+    REQUIRE_FALSE( giver->is_travelling() );
+
+    // The test avatar is never given an id, and missions are assigned by id
+    if( !g->u.getID().is_valid() ) {
+        g->u.setID( g->assign_npc_id() );
+    }
+    mission *const miss = mission::reserve_new( mission_type_id( "MISSION_GET_ANTIBIOTICS" ),
+                          giver->getID() );
+    miss->assign( g->u );
+    overmap_buffer.unload_cold( 0 );
+    CHECK( overmap_buffer.find_npc( giver->getID() ) == giver );
+
+    // Failed missions still show their giver
+    miss->fail();
+    overmap_buffer.unload_cold( 0 );
+    CHECK( overmap_buffer.find_npc( giver->getID() ) == giver );
+    overmap_buffer.remove_npc( giver->getID() );
+}
+
+// Benchmarks are skipped by default by using [.] tag
+TEST_CASE( "overmap_generation_benchmark", "[.][overmap][benchmark]" )
+{
+    constexpr int overmaps_to_construct = 4;
+    rng_set_engine_seed( 4242 );
+    overmap_generation_timings &timings = overmap_generation_timings::get();
+    timings.reset();
+
+    for( int i = 0; i < overmaps_to_construct; ++i ) {
+        const point addr( 100 + i, 100 );
+        overmap_special_batch test_specials = overmap_specials::get_default_batch( addr );
+        overmap_buffer.create_custom_overmap( addr, test_specials );
+    }
+    REQUIRE( timings.overmaps == overmaps_to_construct );
+
+    std::chrono::microseconds total( 0 );
+    for( const std::pair<std::string, std::chrono::microseconds> &stage : timings.stages ) {
+        cata_printf( "%-20s %8.2f ms per overmap\n", stage.first,
+                     stage.second.count() / 1000.0 / timings.overmaps );
+        total += stage.second;
+    }
+    cata_printf( "%-20s %8.2f ms per overmap\n", "total", total.count() / 1000.0 / timings.overmaps );
+}
@@ -1,13 +1,17 @@
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "calendar.h"
 #include "catch/catch.hpp"
 #include "enums.h"
+#include "game.h"
 #include "item.h"
 #include "map.h"
 #include "map_helpers.h"
 #include "point.h"
 #include "weather.h"
+#include "weather_gen.h"
 
 static void set_map_temperature( int new_temperature )
 {
@@ -116,3 +120,57 @@ TEST_CASE( "Items rot away" )
         CHECK( m.i_at( loc ).empty() );
     }
 }
+
+TEST_CASE( "Batched rot processing matches regular processing" )
+{
+    if( calendar::turn <= calendar::start_of_cataclysm ) {
+        calendar::turn = calendar::start_of_cataclysm + 1_minutes;
+    }
+    set_map_temperature( 65 ); // 18,3 C
+
+    item regular_item( "meat_cooked" );
+    item batched_item( "meat_cooked" );
+    REQUIRE( batched_item.has_rot_only_processing() );
+
+    // Cover both the short interval and the long "out of bubble" catch-up.
+    const std::vector<time_duration> steps = { 20_minutes, 3_hours };
+    for( const time_duration &step : steps ) {
+        calendar::turn += step;
+        const int temp = get_weather().get_temperature( tripoint_zero );
+        regular_item.process( nullptr, tripoint_zero, false, 1, temperature_flag::TEMP_FRIDGE );
+        batched_item.process_rot_with_temperature( temp, tripoint_zero,
+                temperature_flag::TEMP_FRIDGE );
+        CHECK( batched_item.get_rot() == regular_item.get_rot() );
+    }
+}
+
+TEST_CASE( "Rot catch-up after a long absence matches hourly simulation" )
+{
+    if( calendar::turn <= calendar::start_of_cataclysm ) {
+        calendar::turn = calendar::start_of_cataclysm + 1_minutes;
+    }
+    set_map_temperature( 65 ); // 18,3 C
+
+    const tripoint pos = tripoint_zero;
+    item caught_up_item( "meat_cooked" );
+    item stepped_item( "meat_cooked" );
+    const time_point start = calendar::turn;
+
+    calendar::turn += 3_days + 17_minutes;
+
+    // Reference: the past simulated in one hour steps starting at item creation.
+    const weather_generator &wgen = get_weather().get_cur_weather_gen();
+    const int local_mod = g->new_game ? 0 : get_map().get_temperature( pos );
+    time_point time = start;
+    while( calendar::turn - time > 1_hours ) {
+        time += std::min( 1_hours, calendar::turn - 1_hours - time );
+        stepped_item.calc_rot( time, wgen.get_weather_temperature( pos, time, g->get_seed() ) +
+                               local_mod );
+    }
+    stepped_item.calc_rot( calendar::turn, get_weather().get_temperature( pos ) );
+
+    caught_up_item.process( nullptr, pos, false, 1, temperature_flag::TEMP_NORMAL );
+
+    CHECK( to_turns<int>( caught_up_item.get_rot() ) ==
+           Approx( to_turns<int>( stepped_item.get_rot() ) ).epsilon( 0.01 ) );
+}
@@ -0,0 +1,87 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "catch/catch.hpp"
+#include "slot_map.h"
+
+TEST_CASE( "slot_map_insert_and_erase", "[slot_map]" )
+{
+    cata::slot_map<std::string> m;
+    CHECK( m.empty() );
+
+    const cata::slot_map_handle a = m.insert( "a" );
+    const cata::slot_map_handle b = m.insert( "b" );
+    const cata::slot_map_handle c = m.insert( "c" );
+    REQUIRE( m.size() == 3 );
+    CHECK( *m.get( a ) == "a" );
+    CHECK( *m.get( b ) == "b" );
+    CHECK( *m.get( c ) == "c" );
+
+    // Erasing moves the last element into the gap, handles stay valid
+    CHECK( m.erase( a ) );
+    CHECK( m.size() == 2 );
+    CHECK( m.get( a ) == nullptr );
+    CHECK( *m.get( b ) == "b" );
+    CHECK( *m.get( c ) == "c" );
+    CHECK_FALSE( m.erase( a ) );
+
+    std::vector<std::string> values( m.begin(), m.end() );
+    std::sort( values.begin(), values.end() );
+    CHECK( values == std::vector<std::string> { "b", "c" } );
+}
+
+TEST_CASE( "slot_map_reused_slot_invalidates_old_handle", "[slot_map]" )
+{
+    cata::slot_map<int> m;
+    const cata::slot_map_handle old_handle = m.insert( 1 );
+    REQUIRE( m.erase( old_handle ) );
+
+    const cata::slot_map_handle new_handle = m.insert( 2 );
+    // The slot is reused, but the generation tells the handles apart
+    CHECK( new_handle.index == old_handle.index );
+    CHECK( new_handle != old_handle );
+    CHECK_FALSE( m.contains( old_handle ) );
+    CHECK_FALSE( m.erase( old_handle ) );
+    CHECK( *m.get( new_handle ) == 2 );
+}
+
+TEST_CASE( "slot_map_handle_at_matches_dense_order", "[slot_map]" )
+{
+    cata::slot_map<int> m;
+    std::vector<cata::slot_map_handle> handles;
+    for( int i = 0; i < 10; ++i ) {
+        handles.push_back( m.insert( i ) );
+    }
+    for( int i = 0; i < 10; i += 3 ) {
+        m.erase( handles[i] );
+    }
+    for( size_t i = 0; i < m.size(); ++i ) {
+        CHECK( m.get( m.handle_at( i ) ) == &m[i] );
+    }
+    m.clear();
+    CHECK( m.empty() );
+    for( const cata::slot_map_handle &h : handles ) {
+        CHECK_FALSE( m.contains( h ) );
+    }
+}
+
+TEST_CASE( "slot_map_swap_at_keeps_handles_valid", "[slot_map]" )
+{
+    cata::slot_map<int> m;
+    const cata::slot_map_handle a = m.insert( 1 );
+    const cata::slot_map_handle b = m.insert( 2 );
+    const cata::slot_map_handle c = m.insert( 3 );
+    REQUIRE( m.index_of( a ) == 0 );
+    REQUIRE( m.index_of( c ) == 2 );
+
+    m.swap_at( 0, 2 );
+    CHECK( m[0] == 3 );
+    CHECK( m[2] == 1 );
+    CHECK( m.index_of( a ) == 2 );
+    CHECK( m.index_of( c ) == 0 );
+    CHECK( *m.get( a ) == 1 );
+    CHECK( *m.get( b ) == 2 );
+    CHECK( *m.get( c ) == 3 );
+    CHECK( m.handle_at( 0 ) == c );
+}
@@ -15,6 +15,7 @@
 #include "optional.h"
 #include "point.h"
 #include "type_id.h"
+#include "veh_type.h"
 #include "vehicle.h"
 #include "vehicle_selector.h"
 #include "weather.h"
@@ -247,3 +248,33 @@ TEST_CASE( "Vehicle charging station", "[vehicle][power]" )
     }
 
 }
+
+TEST_CASE( "vehicle part index follows installed parts", "[vehicle][power]" )
+{
+    reset_player();
+    build_test_map( ter_id( "t_pavement" ) );
+    clear_vehicles();
+
+    vehicle *veh_ptr = g->m.add_vehicle( vproto_id( "solar_panel_test" ), tripoint( 5, 5, 0 ), 0, 0,
+                                         0 );
+    REQUIRE( veh_ptr != nullptr );
+    REQUIRE( veh_ptr->batteries.size() == 1 );
+    CHECK( veh_ptr->has_part( VPFLAG_SOLAR_PANEL ) );
+    CHECK( veh_ptr->has_part( VPFLAG_SOLAR_PANEL ) == veh_ptr->has_part( "SOLAR_PANEL" ) );
+    CHECK_FALSE( veh_ptr->has_part( VPFLAG_STEREO ) );
+
+    veh_ptr->discharge_battery( veh_ptr->fuel_left( fuel_type_battery ) );
+    REQUIRE( veh_ptr->fuel_left( fuel_type_battery ) == 0 );
+    CHECK( veh_ptr->charge_battery( 50 ) == 0 );
+    CHECK( veh_ptr->fuel_left( fuel_type_battery ) == 50 );
+
+    for( const int p : std::vector<int>( veh_ptr->solar_panels ) ) {
+        veh_ptr->remove_part( p );
+    }
+    veh_ptr->part_removal_cleanup();
+    CHECK_FALSE( veh_ptr->has_part( VPFLAG_SOLAR_PANEL ) );
+    CHECK_FALSE( veh_ptr->has_part( "SOLAR_PANEL" ) );
+    REQUIRE( veh_ptr->batteries.size() == 1 );
+    CHECK( veh_ptr->discharge_battery( 20 ) == 0 );
+    CHECK( veh_ptr->fuel_left( fuel_type_battery ) == 30 );
+}
@@ -1,4 +1,5 @@
 #include <memory>
+#include <set>
 #include <vector>
 
 #include "avatar.h"
@@ -13,6 +14,7 @@
 #include "point.h"
 #include "type_id.h"
 #include "vehicle.h"
+#include "vpart_position.h"
 
 TEST_CASE( "detaching_vehicle_unboards_passengers" )
 {
@@ -72,3 +74,40 @@ TEST_CASE( "add_item_to_broken_vehicle_part" )
     const item itm2 = item( "jeans" );
     REQUIRE( !veh_ptr->add_item( *cargo_part, itm2 ) );
 }
+
+TEST_CASE( "vehicle_part_cache_follows_moved_vehicle", "[vehicle]" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint vehicle_origin( 60, 60, 0 );
+    vehicle *veh_ptr = here.add_vehicle( vproto_id( "car" ), vehicle_origin, 0, 0, 0 );
+    REQUIRE( veh_ptr != nullptr );
+
+    const std::set<tripoint> old_points = veh_ptr->get_points( true );
+    REQUIRE( !old_points.empty() );
+    for( const tripoint &p : old_points ) {
+        const optional_vpart_position vp = here.veh_at( p );
+        REQUIRE( vp );
+        CHECK( &vp->vehicle() == veh_ptr );
+        CHECK( vp->vehicle().global_part_pos3( vp->part_index() ) == p );
+    }
+
+    REQUIRE( here.displace_vehicle( *veh_ptr, tripoint_east ) );
+    const std::set<tripoint> new_points = veh_ptr->get_points( true );
+    for( const tripoint &p : new_points ) {
+        const optional_vpart_position vp = here.veh_at( p );
+        REQUIRE( vp );
+        CHECK( &vp->vehicle() == veh_ptr );
+        CHECK( vp->vehicle().global_part_pos3( vp->part_index() ) == p );
+    }
+    for( const tripoint &p : old_points ) {
+        if( !new_points.count( p ) ) {
+            CHECK_FALSE( here.veh_at( p ) );
+        }
+    }
+
+    here.detach_vehicle( veh_ptr );
+    for( const tripoint &p : new_points ) {
+        CHECK_FALSE( here.veh_at( p ) );
+    }
+}
@@ -2,6 +2,7 @@
 #include "calendar.h"
 #include "inventory.h"
 #include "item.h"
+#include "type_id.h"
 
 TEST_CASE( "visitable_summation" )
 {
@@ -18,3 +19,25 @@ TEST_CASE( "visitable_summation" )
 
     CHECK( test_inv.charges_of( "water", item::INFINITE_CHARGES ) > 1 );
 }
+
+TEST_CASE( "inventory_quality_counts_follow_changes" )
+{
+    const quality_id qual_HAMMER( "HAMMER" );
+    inventory test_inv;
+    CHECK_FALSE( test_inv.has_quality( qual_HAMMER ) );
+
+    test_inv.add_item( item( "hammer", calendar::turn ) );
+    CHECK( test_inv.has_quality( qual_HAMMER, 1, 1 ) );
+    CHECK_FALSE( test_inv.has_quality( qual_HAMMER, 1, 2 ) );
+    CHECK_FALSE( test_inv.has_quality( qual_HAMMER, 100 ) );
+
+    test_inv.add_item( item( "hammer", calendar::turn ) );
+    CHECK( test_inv.has_quality( qual_HAMMER, 1, 2 ) );
+
+    const inventory copied = test_inv;
+    CHECK( copied.has_quality( qual_HAMMER, 1, 2 ) );
+
+    test_inv.clear();
+    CHECK_FALSE( test_inv.has_quality( qual_HAMMER ) );
+    CHECK( copied.has_quality( qual_HAMMER, 1, 2 ) );
+}
@@ -4,6 +4,7 @@
 
 #include "calendar.h"
 #include "catch/catch.hpp"
+#include "game_constants.h"
 #include "point.h"
 #include "weather.h"
 #include "weather_gen.h"
@@ -335,3 +336,96 @@ TEST_CASE( "local wind chill calculation", "[weather][wind_chill]" )
         }
     }
 }
+
+TEST_CASE( "hourly weather sums match the stepped sums", "[weather]" )
+{
+    weather_manager &weather = get_weather();
+    // Other tests may have left a fixed weather behind
+    const weather_type old_override = weather.weather_override;
+    weather.weather_override = WEATHER_NULL;
+    weather.clear_temp_cache();
+
+    // The corner of an overmap terrain, where the shared hours are sampled
+    const tripoint location( 5 * SEEX * 2, 19 * SEEY * 2, 0 );
+
+    SECTION( "spans starting on a full hour sample the same times" ) {
+        const time_point start = calendar::turn_zero + 3_days;
+        const time_duration span = GENERATE( 2_days + 5_hours + 31_minutes,
+                                             9_days + 7_hours + 12_minutes + 5_turns );
+        const time_point end = start + span;
+        CAPTURE( to_turns<int>( span ) );
+
+        const weather_sum stepped = sum_conditions( start, end, location );
+        const weather_sum hourly = sum_hourly_conditions( start, end, location );
+        CHECK( hourly.rain_amount == stepped.rain_amount );
+        CHECK( hourly.acid_amount == stepped.acid_amount );
+        CHECK( hourly.wind_amount == stepped.wind_amount );
+        CHECK( hourly.sunlight == Approx( stepped.sunlight ).epsilon( 0.001 ) );
+    }
+
+    SECTION( "other spans only differ where the weather changes within a minute" ) {
+        const time_point start = calendar::turn_zero + 3_days + 17_minutes + 4_turns;
+        const time_point end = start + 2_days + 5_hours + 31_minutes;
+        const weather_sum stepped = sum_conditions( start, end, location );
+        const weather_sum hourly = sum_hourly_conditions( start, end, location );
+        // Heaviest rain over one minute for every change of the weather
+        const double margin = 8.0 * to_turns<int>( 1_minutes ) * 40;
+        CHECK( hourly.rain_amount == Approx( stepped.rain_amount ).epsilon( 0.05 ).margin( margin ) );
+        CHECK( hourly.acid_amount == Approx( stepped.acid_amount ).epsilon( 0.05 ).margin( margin ) );
+        CHECK( hourly.wind_amount == stepped.wind_amount );
+        CHECK( hourly.sunlight == Approx( stepped.sunlight ).epsilon( 0.01 ) );
+    }
+
+    SECTION( "spans over a month stay close to the stepped sums" ) {
+        const time_point start = calendar::turn_zero + 3_days + 17_minutes;
+        const time_point end = start + 30_days;
+        const weather_sum stepped = sum_conditions( start, end, location );
+        const weather_sum hourly = sum_hourly_conditions( start, end, location );
+        CHECK( hourly.sunlight == Approx( stepped.sunlight ).epsilon( 0.01 ) );
+    }
+
+    SECTION( "vehicles on the same overmap terrain share the hours" ) {
+        const time_point start = calendar::turn_zero + 3_days;
+        const time_point end = start + 2_days;
+        const weather_sum hourly = sum_hourly_conditions( start, end, location );
+        const weather_sum neighbour = sum_hourly_conditions( start, end, location + point( 1, 1 ) );
+        CHECK( neighbour.rain_amount == hourly.rain_amount );
+        CHECK( neighbour.acid_amount == hourly.acid_amount );
+        CHECK( neighbour.sunlight == Approx( hourly.sunlight ).epsilon( 0.001 ) );
+    }
+
+    weather.weather_override = old_override;
+    weather.clear_temp_cache();
+}
+
+// Benchmarks are skipped by default by using [.] tag
+TEST_CASE( "weather_sum_benchmark", "[.][weather][benchmark]" )
+{
+    weather_manager &weather = get_weather();
+    const weather_type old_override = weather.weather_override;
+    weather.weather_override = WEATHER_NULL;
+    weather.clear_temp_cache();
+    // A few vehicles parked on the same overmap terrain, catching up on a month
+    constexpr int vehicles = 8;
+    const tripoint location( 5 * SEEX * 2, 19 * SEEY * 2, 0 );
+    const time_point start = calendar::turn_zero + 3_days + 17_minutes;
+    const time_point end = start + 30_days;
+
+    BENCHMARK( "sum_conditions" ) {
+        float sunlight = 0.0f;
+        for( int i = 0; i < vehicles; ++i ) {
+            sunlight += sum_conditions( start, end, location + point( i, 0 ) ).sunlight;
+        }
+        return sunlight;
+    };
+    BENCHMARK( "sum_hourly_conditions" ) {
+        float sunlight = 0.0f;
+        for( int i = 0; i < vehicles; ++i ) {
+            sunlight += sum_hourly_conditions( start, end, location + point( i, 0 ) ).sunlight;
+        }
+        return sunlight;
+    };
+
+    weather.weather_override = old_override;
+    weather.clear_temp_cache();
+}